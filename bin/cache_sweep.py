@@ -0,0 +1,232 @@
+#! /usr/bin/env python3
+# ---------------------------------------------------------------------------
+# SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+# SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+# SPDX-FileContributor: 2026 Bradley M. Bell
+# ---------------------------------------------------------------------------
+# {xrst_begin cache_sweep.py}
+# {xrst_spell
+#     sys
+# }
+# {xrst_comment_ch #}
+#
+# Sweep n_arg and Report the Cache Level for Each Package
+# #######################################################
+#
+# Syntax
+# ******
+# | ``bin/cache_sweep.py`` [ ``--flush_cache`` ]
+#
+# Purpose
+# *******
+# The speed of a derivative computation changes when its tape, and work space,
+# no longer fit in a cache level.
+# This program runs the C++ version of :ref:`run_cmpad-name`
+# for the ``an_ode`` and ``llsq_obj`` algorithms,
+# for each of the AD packages that are available,
+# doubling *n_arg* until the tape no longer fits in the last level cache
+# (or *n_arg* reaches its maximum value).
+# It then reports the values of *n_arg* where the tape for each package
+# crosses a cache level; see :ref:`csv_column@cache_level` .
+#
+# Cache Sizes
+# ***********
+# The cache sizes are read from the files
+# ``/sys/devices/system/cpu/cpu0/cache/index``\ *i* ;
+# see :ref:`cache_info-name` .
+#
+# flush_cache
+# ***********
+# If this argument is present, it is passed to run_cmpad; see
+# :ref:`run_cmpad@flush_cache` .
+#
+# cache_sweep.csv
+# ***************
+# The results for each case are placed in this file.
+# If this file already exists, the previous version is removed
+# and a completely new version is created.
+#
+# Source Code
+# ***********
+# {xrst_literal
+#     # BEGIN PYTHON
+#     # END PYTHON
+# }
+# {xrst_end cache_sweep.py}
+# -----------------------------------------------------------------------------
+# BEGIN PYTHON
+import sys
+import os
+import csv
+import re
+import subprocess
+#
+# cpp_run_cmpad
+cpp_run_cmpad = 'cpp/build/src/run_cmpad'
+#
+# cache_size
+# size in bytes of the data (or unified) cache for each level
+def cache_size() :
+   size      = dict()
+   directory = '/sys/devices/system/cpu/cpu0/cache'
+   index     = 0
+   while os.path.isdir( f'{directory}/index{index}' ) :
+      index_dir = f'{directory}/index{index}'
+      index    += 1
+      value     = dict()
+      for name in [ 'level', 'type', 'size' ] :
+         file_obj    = open( f'{index_dir}/{name}' )
+         value[name] = file_obj.read().strip()
+         file_obj.close()
+      if value['type'] != 'Instruction' :
+         match = re.fullmatch( r'([0-9]+)([KMG]?)', value['size'] )
+         if match != None :
+            shift = { '' : 0, 'K' : 10, 'M' : 20, 'G' : 30 }[ match.group(2) ]
+            size[ int( value['level'] ) ] = int( match.group(1) ) << shift
+   return [ size[level] for level in sorted( size.keys() ) ]
+#
+# level_name
+def level_name(level, n_level) :
+   if level > n_level :
+      return 'memory'
+   return f'L{level}'
+#
+def main() :
+   #
+   # program
+   program = 'bin/cache_sweep.py'
+   #
+   # configure_file
+   configure_file = 'cpp/include/cmpad/configure.hpp'
+   #
+   # flush_cache
+   flush_cache = sys.argv[1:] == [ '--flush_cache' ]
+   #
+   # check
+   if len(sys.argv) != 1 and not flush_cache :
+      msg = f'usage: {program} [--flush_cache]'
+      sys.exit(msg)
+   if sys.argv[0] != program :
+      msg = f'{program}: must be executed from the top source directory'
+      sys.exit(msg)
+   if not os.path.isfile(configure_file) :
+      msg  = f'{program}: {configure_file} does not exist.'
+      msg += '\nUse cpp/bin/run_cmake.sh to create it.'
+      sys.exit(msg)
+   if not os.path.isfile(cpp_run_cmpad ) :
+      msg           = f'{program}: {cpp_run_cmpad} does not exist.'
+      msg          += '\nUse use make in cpp/build to create it.'
+      sys.exit(msg)
+   #
+   # size, n_level
+   size    = cache_size()
+   n_level = len(size)
+   if n_level == 0 :
+      sys.exit( f'{program}: the cache sizes are not available' )
+   for level in range(1, n_level + 1) :
+      print( f'L{level} cache = {size[level-1]} bytes' )
+   #
+   # package_list
+   # use configure file to determine list of available packages
+   package_list = list()
+   file_obj  = open(configure_file, 'r')
+   file_data = file_obj.read()
+   file_obj.close()
+   ad_package = 'adept,adolc,autodiff,codi,cppad,cppad_jit,cppadcg,sacado'
+   for package in ad_package.split(',') :
+      PACKAGE = package.upper()
+      pattern = f'# *define *CMPAD_HAS_{PACKAGE} *[01]'
+      match   = re.search(pattern, file_data)
+      if match == None :
+         msg   = f'{program}: {configure_file} cannot find the pattern'
+         msg += f'\n{pattern}'
+         sys.exit(msg)
+      if match.group(0)[-1] == '1' :
+         package_list.append(package)
+   print( f'package_list = {package_list}' )
+   if len(package_list) == 0 :
+      sys.exit( f'{program}: no AD packages are available' )
+   #
+   # file_name
+   file_name = 'cache_sweep.csv'
+   if os.path.isfile(file_name) :
+      os.remove(file_name)
+   #
+   # min_time, max_n_arg
+   min_time  = 0.1
+   max_n_arg = 2 ** 14
+   #
+   # n_other_dict
+   n_other_dict = {
+      'an_ode'       : 9 ,
+      'llsq_obj'     : 100
+   }
+   #
+   # algorithm
+   for algorithm in [ 'an_ode', 'llsq_obj' ] :
+      #
+      # n_other
+      n_other = n_other_dict[algorithm]
+      #
+      # package
+      for package in package_list :
+         #
+         # previous_level
+         previous_level = None
+         #
+         # n_arg
+         n_arg = 2
+         while n_arg <= max_n_arg :
+            #
+            # command
+            command = [
+               cpp_run_cmpad,
+               f'--package={package}',
+               f'--algorithm={algorithm}',
+               f'--n_arg={n_arg}',
+               f'--n_other={n_other}',
+               f'--min_time={min_time}',
+               f'--file_name={file_name}',
+            ]
+            if flush_cache :
+               command.append('--flush_cache')
+            #
+            # run command
+            result = subprocess.run(command)
+            if result.returncode != 0 :
+               msg  = ' '.join(command)
+               msg += f'\n{program}: command above failed'
+               sys.exit(msg)
+            #
+            # row
+            # the last row of the file corresponds to this command
+            file_obj = open(file_name)
+            row      = list( csv.DictReader(file_obj) )[-1]
+            file_obj.close()
+            #
+            # level
+            level = row.get('cache_level', '')
+            if level == '' :
+               print( f'{package}, {algorithm}: does not report tape_bytes' )
+               break
+            level = int(level)
+            #
+            # report
+            if level != previous_level :
+               name = level_name(level, n_level)
+               print(
+                  f'{package}, {algorithm}: n_arg = {n_arg}, ' +
+                  f'tape_bytes = {row["tape_bytes"]}, ' +
+                  f'work_bytes = {row["work_bytes"]}: {name}'
+               )
+            previous_level = level
+            #
+            # n_arg
+            if level > n_level :
+               break
+            n_arg = 2 * n_arg
+   #
+   print( f'{program}: OK')
+#
+main()
+# END PYTHON
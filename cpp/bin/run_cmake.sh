@@ -12,11 +12,12 @@ then
    exit 1
 fi
 #
-# compiler, build_type, vector
+# compiler, build_type, vector, alloc_count
 compiler=''
 build_type='release'
 code_generator=""
 vector='-D cmpad_vector=std'
+alloc_count='-D cmpad_alloc_count=NO'
 verbose='-D CMAKE_VERBOSE_MAKEFILE=NO'
 for (( i=1; i<=$#; i++ ))
 do
@@ -39,6 +40,10 @@ do
       vector='-D cmpad_vector=cppad'
       ;;
 
+      --alloc_count)
+      alloc_count='-D cmpad_alloc_count=YES'
+      ;;
+
       --verbose)
       verbose='-D CMAKE_VERBOSE_MAKEFILE=YES'
       ;;
@@ -49,6 +54,7 @@ do
       echo '   [--debug] \'
       echo '   [--ninja ] \ '
       echo '   [--cppad_vector] \'
+      echo '   [--alloc_count] \'
       echo '   [--verbose]'
       exit 0
       ;;
@@ -79,9 +85,11 @@ cmake_build_type="-D CMAKE_BUILD_TYPE=$build_type"
 #
 # make
 echo cmake -B . -S .. \
-   $code_generator $for_sacado $compiler $cmake_build_type $vector $verbose
+   $code_generator $for_sacado $compiler $cmake_build_type \
+   $vector $alloc_count $verbose
 cmake -B . -S .. \
-   $code_generator $for_sacado $compiler $cmake_build_type $vector $verbose
+   $code_generator $for_sacado $compiler $cmake_build_type \
+   $vector $alloc_count $verbose
 # -----------------------------------------------------------------------------
 echo 'bin/run_cmake.sh: OK'
 exit 0
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp/lib/alloc_count.cpp" "lib/CMakeFiles/cmpad.dir/alloc_count.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/alloc_count.cpp.o.d"
+  "/root/repo/cpp/lib/bench_env.cpp" "lib/CMakeFiles/cmpad.dir/bench_env.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/bench_env.cpp.o.d"
+  "/root/repo/cpp/lib/break_even.cpp" "lib/CMakeFiles/cmpad.dir/break_even.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/break_even.cpp.o.d"
+  "/root/repo/cpp/lib/cache_info.cpp" "lib/CMakeFiles/cmpad.dir/cache_info.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/cache_info.cpp.o.d"
+  "/root/repo/cpp/lib/case_sample.cpp" "lib/CMakeFiles/cmpad.dir/case_sample.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/case_sample.cpp.o.d"
+  "/root/repo/cpp/lib/cold_start.cpp" "lib/CMakeFiles/cmpad.dir/cold_start.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/cold_start.cpp.o.d"
+  "/root/repo/cpp/lib/csv_append.cpp" "lib/CMakeFiles/cmpad.dir/csv_append.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_append.cpp.o.d"
+  "/root/repo/cpp/lib/csv_cold_start.cpp" "lib/CMakeFiles/cmpad.dir/csv_cold_start.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_cold_start.cpp.o.d"
+  "/root/repo/cpp/lib/csv_latency.cpp" "lib/CMakeFiles/cmpad.dir/csv_latency.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_latency.cpp.o.d"
+  "/root/repo/cpp/lib/csv_read.cpp" "lib/CMakeFiles/cmpad.dir/csv_read.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_read.cpp.o.d"
+  "/root/repo/cpp/lib/csv_scan.cpp" "lib/CMakeFiles/cmpad.dir/csv_scan.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_scan.cpp.o.d"
+  "/root/repo/cpp/lib/csv_speed.cpp" "lib/CMakeFiles/cmpad.dir/csv_speed.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_speed.cpp.o.d"
+  "/root/repo/cpp/lib/csv_write.cpp" "lib/CMakeFiles/cmpad.dir/csv_write.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/csv_write.cpp.o.d"
+  "/root/repo/cpp/lib/fun_compare.cpp" "lib/CMakeFiles/cmpad.dir/fun_compare.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/fun_compare.cpp.o.d"
+  "/root/repo/cpp/lib/jit_lib.cpp" "lib/CMakeFiles/cmpad.dir/jit_lib.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/jit_lib.cpp.o.d"
+  "/root/repo/cpp/lib/mann_whitney.cpp" "lib/CMakeFiles/cmpad.dir/mann_whitney.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/mann_whitney.cpp.o.d"
+  "/root/repo/cpp/lib/perf_counter.cpp" "lib/CMakeFiles/cmpad.dir/perf_counter.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/perf_counter.cpp.o.d"
+  "/root/repo/cpp/lib/phase_timer.cpp" "lib/CMakeFiles/cmpad.dir/phase_timer.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/phase_timer.cpp.o.d"
+  "/root/repo/cpp/lib/results_query.cpp" "lib/CMakeFiles/cmpad.dir/results_query.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/results_query.cpp.o.d"
+  "/root/repo/cpp/lib/results_store.cpp" "lib/CMakeFiles/cmpad.dir/results_store.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/results_store.cpp.o.d"
+  "/root/repo/cpp/lib/sample_profiler.cpp" "lib/CMakeFiles/cmpad.dir/sample_profiler.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/sample_profiler.cpp.o.d"
+  "/root/repo/cpp/lib/speed_clock.cpp" "lib/CMakeFiles/cmpad.dir/speed_clock.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/speed_clock.cpp.o.d"
+  "/root/repo/cpp/lib/speed_stat.cpp" "lib/CMakeFiles/cmpad.dir/speed_stat.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/speed_stat.cpp.o.d"
+  "/root/repo/cpp/lib/trace_event.cpp" "lib/CMakeFiles/cmpad.dir/trace_event.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/trace_event.cpp.o.d"
+  "/root/repo/cpp/lib/uniform_01.cpp" "lib/CMakeFiles/cmpad.dir/uniform_01.cpp.o" "gcc" "lib/CMakeFiles/cmpad.dir/uniform_01.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/cpp/build/lib/libcmpad.so" "/root/repo/cpp/build/lib/libcmpad.so.2024.9.30"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,60 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmpad.dir/alloc_count.cpp.o"
+  "CMakeFiles/cmpad.dir/alloc_count.cpp.o.d"
+  "CMakeFiles/cmpad.dir/bench_env.cpp.o"
+  "CMakeFiles/cmpad.dir/bench_env.cpp.o.d"
+  "CMakeFiles/cmpad.dir/break_even.cpp.o"
+  "CMakeFiles/cmpad.dir/break_even.cpp.o.d"
+  "CMakeFiles/cmpad.dir/cache_info.cpp.o"
+  "CMakeFiles/cmpad.dir/cache_info.cpp.o.d"
+  "CMakeFiles/cmpad.dir/case_sample.cpp.o"
+  "CMakeFiles/cmpad.dir/case_sample.cpp.o.d"
+  "CMakeFiles/cmpad.dir/cold_start.cpp.o"
+  "CMakeFiles/cmpad.dir/cold_start.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_append.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_append.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_cold_start.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_cold_start.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_latency.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_latency.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_read.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_read.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_scan.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_scan.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_speed.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_speed.cpp.o.d"
+  "CMakeFiles/cmpad.dir/csv_write.cpp.o"
+  "CMakeFiles/cmpad.dir/csv_write.cpp.o.d"
+  "CMakeFiles/cmpad.dir/fun_compare.cpp.o"
+  "CMakeFiles/cmpad.dir/fun_compare.cpp.o.d"
+  "CMakeFiles/cmpad.dir/jit_lib.cpp.o"
+  "CMakeFiles/cmpad.dir/jit_lib.cpp.o.d"
+  "CMakeFiles/cmpad.dir/mann_whitney.cpp.o"
+  "CMakeFiles/cmpad.dir/mann_whitney.cpp.o.d"
+  "CMakeFiles/cmpad.dir/perf_counter.cpp.o"
+  "CMakeFiles/cmpad.dir/perf_counter.cpp.o.d"
+  "CMakeFiles/cmpad.dir/phase_timer.cpp.o"
+  "CMakeFiles/cmpad.dir/phase_timer.cpp.o.d"
+  "CMakeFiles/cmpad.dir/results_query.cpp.o"
+  "CMakeFiles/cmpad.dir/results_query.cpp.o.d"
+  "CMakeFiles/cmpad.dir/results_store.cpp.o"
+  "CMakeFiles/cmpad.dir/results_store.cpp.o.d"
+  "CMakeFiles/cmpad.dir/sample_profiler.cpp.o"
+  "CMakeFiles/cmpad.dir/sample_profiler.cpp.o.d"
+  "CMakeFiles/cmpad.dir/speed_clock.cpp.o"
+  "CMakeFiles/cmpad.dir/speed_clock.cpp.o.d"
+  "CMakeFiles/cmpad.dir/speed_stat.cpp.o"
+  "CMakeFiles/cmpad.dir/speed_stat.cpp.o.d"
+  "CMakeFiles/cmpad.dir/trace_event.cpp.o"
+  "CMakeFiles/cmpad.dir/trace_event.cpp.o.d"
+  "CMakeFiles/cmpad.dir/uniform_01.cpp.o"
+  "CMakeFiles/cmpad.dir/uniform_01.cpp.o.d"
+  "libcmpad.pdb"
+  "libcmpad.so"
+  "libcmpad.so.2024.9.30"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmpad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
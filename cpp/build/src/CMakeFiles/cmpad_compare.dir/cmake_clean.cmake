@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmpad_compare.dir/cmpad_compare.cpp.o"
+  "CMakeFiles/cmpad_compare.dir/cmpad_compare.cpp.o.d"
+  "cmpad_compare"
+  "cmpad_compare.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmpad_compare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cmpad_query.dir/cmpad_query.cpp.o"
+  "CMakeFiles/cmpad_query.dir/cmpad_query.cpp.o.d"
+  "cmpad_query"
+  "cmpad_query.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cmpad_query.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp/src/parse_args.cpp" "src/CMakeFiles/run_cmpad.dir/parse_args.cpp.o" "gcc" "src/CMakeFiles/run_cmpad.dir/parse_args.cpp.o.d"
+  "/root/repo/cpp/src/run_cmpad.cpp" "src/CMakeFiles/run_cmpad.dir/run_cmpad.cpp.o" "gcc" "src/CMakeFiles/run_cmpad.dir/run_cmpad.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cpp/build/lib/CMakeFiles/cmpad.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
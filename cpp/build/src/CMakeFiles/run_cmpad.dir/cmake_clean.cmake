@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run_cmpad.dir/parse_args.cpp.o"
+  "CMakeFiles/run_cmpad.dir/parse_args.cpp.o.d"
+  "CMakeFiles/run_cmpad.dir/run_cmpad.cpp.o"
+  "CMakeFiles/run_cmpad.dir/run_cmpad.cpp.o.d"
+  "run_cmpad"
+  "run_cmpad.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/run_cmpad.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp/test/none.cpp" "test/CMakeFiles/test.dir/none.cpp.o" "gcc" "test/CMakeFiles/test.dir/none.cpp.o.d"
+  "/root/repo/cpp/test/test.cpp" "test/CMakeFiles/test.dir/test.cpp.o" "gcc" "test/CMakeFiles/test.dir/test.cpp.o.d"
+  "/root/repo/cpp/test/xam.cpp" "test/CMakeFiles/test.dir/xam.cpp.o" "gcc" "test/CMakeFiles/test.dir/xam.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cpp/build/xam/CMakeFiles/xam.dir/DependInfo.cmake"
+  "/root/repo/cpp/build/lib/CMakeFiles/cmpad.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cpp/xam/alloc_count.cpp" "xam/CMakeFiles/xam.dir/alloc_count.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/alloc_count.cpp.o.d"
+  "/root/repo/cpp/xam/an_ode.cpp" "xam/CMakeFiles/xam.dir/an_ode.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/an_ode.cpp.o.d"
+  "/root/repo/cpp/xam/bench_env.cpp" "xam/CMakeFiles/xam.dir/bench_env.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/bench_env.cpp.o.d"
+  "/root/repo/cpp/xam/break_even.cpp" "xam/CMakeFiles/xam.dir/break_even.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/break_even.cpp.o.d"
+  "/root/repo/cpp/xam/cache_info.cpp" "xam/CMakeFiles/xam.dir/cache_info.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/cache_info.cpp.o.d"
+  "/root/repo/cpp/xam/case_sample.cpp" "xam/CMakeFiles/xam.dir/case_sample.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/case_sample.cpp.o.d"
+  "/root/repo/cpp/xam/cold_start.cpp" "xam/CMakeFiles/xam.dir/cold_start.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/cold_start.cpp.o.d"
+  "/root/repo/cpp/xam/count_scalar.cpp" "xam/CMakeFiles/xam.dir/count_scalar.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/count_scalar.cpp.o.d"
+  "/root/repo/cpp/xam/csv_append.cpp" "xam/CMakeFiles/xam.dir/csv_append.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_append.cpp.o.d"
+  "/root/repo/cpp/xam/csv_cold_start.cpp" "xam/CMakeFiles/xam.dir/csv_cold_start.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_cold_start.cpp.o.d"
+  "/root/repo/cpp/xam/csv_latency.cpp" "xam/CMakeFiles/xam.dir/csv_latency.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_latency.cpp.o.d"
+  "/root/repo/cpp/xam/csv_read.cpp" "xam/CMakeFiles/xam.dir/csv_read.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_read.cpp.o.d"
+  "/root/repo/cpp/xam/csv_scan.cpp" "xam/CMakeFiles/xam.dir/csv_scan.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_scan.cpp.o.d"
+  "/root/repo/cpp/xam/csv_speed.cpp" "xam/CMakeFiles/xam.dir/csv_speed.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_speed.cpp.o.d"
+  "/root/repo/cpp/xam/csv_write.cpp" "xam/CMakeFiles/xam.dir/csv_write.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/csv_write.cpp.o.d"
+  "/root/repo/cpp/xam/det_by_minor.cpp" "xam/CMakeFiles/xam.dir/det_by_minor.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/det_by_minor.cpp.o.d"
+  "/root/repo/cpp/xam/det_of_minor.cpp" "xam/CMakeFiles/xam.dir/det_of_minor.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/det_of_minor.cpp.o.d"
+  "/root/repo/cpp/xam/fun_compare.cpp" "xam/CMakeFiles/xam.dir/fun_compare.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/fun_compare.cpp.o.d"
+  "/root/repo/cpp/xam/fun_obj.cpp" "xam/CMakeFiles/xam.dir/fun_obj.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/fun_obj.cpp.o.d"
+  "/root/repo/cpp/xam/fun_speed.cpp" "xam/CMakeFiles/xam.dir/fun_speed.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/fun_speed.cpp.o.d"
+  "/root/repo/cpp/xam/jit_lib.cpp" "xam/CMakeFiles/xam.dir/jit_lib.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/jit_lib.cpp.o.d"
+  "/root/repo/cpp/xam/latency_histogram.cpp" "xam/CMakeFiles/xam.dir/latency_histogram.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/latency_histogram.cpp.o.d"
+  "/root/repo/cpp/xam/llsq_obj.cpp" "xam/CMakeFiles/xam.dir/llsq_obj.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/llsq_obj.cpp.o.d"
+  "/root/repo/cpp/xam/mann_whitney.cpp" "xam/CMakeFiles/xam.dir/mann_whitney.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/mann_whitney.cpp.o.d"
+  "/root/repo/cpp/xam/near_equal.cpp" "xam/CMakeFiles/xam.dir/near_equal.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/near_equal.cpp.o.d"
+  "/root/repo/cpp/xam/perf_counter.cpp" "xam/CMakeFiles/xam.dir/perf_counter.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/perf_counter.cpp.o.d"
+  "/root/repo/cpp/xam/phase_timer.cpp" "xam/CMakeFiles/xam.dir/phase_timer.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/phase_timer.cpp.o.d"
+  "/root/repo/cpp/xam/results_query.cpp" "xam/CMakeFiles/xam.dir/results_query.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/results_query.cpp.o.d"
+  "/root/repo/cpp/xam/results_store.cpp" "xam/CMakeFiles/xam.dir/results_store.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/results_store.cpp.o.d"
+  "/root/repo/cpp/xam/runge_kutta.cpp" "xam/CMakeFiles/xam.dir/runge_kutta.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/runge_kutta.cpp.o.d"
+  "/root/repo/cpp/xam/sample_profiler.cpp" "xam/CMakeFiles/xam.dir/sample_profiler.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/sample_profiler.cpp.o.d"
+  "/root/repo/cpp/xam/speed_clock.cpp" "xam/CMakeFiles/xam.dir/speed_clock.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/speed_clock.cpp.o.d"
+  "/root/repo/cpp/xam/speed_stat.cpp" "xam/CMakeFiles/xam.dir/speed_stat.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/speed_stat.cpp.o.d"
+  "/root/repo/cpp/xam/static_fun.cpp" "xam/CMakeFiles/xam.dir/static_fun.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/static_fun.cpp.o.d"
+  "/root/repo/cpp/xam/trace_event.cpp" "xam/CMakeFiles/xam.dir/trace_event.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/trace_event.cpp.o.d"
+  "/root/repo/cpp/xam/uniform_01.cpp" "xam/CMakeFiles/xam.dir/uniform_01.cpp.o" "gcc" "xam/CMakeFiles/xam.dir/uniform_01.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/cpp/build/xam/libxam.so" "/root/repo/cpp/build/xam/libxam.so.2024.9.30"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/cpp/build/lib/CMakeFiles/cmpad.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
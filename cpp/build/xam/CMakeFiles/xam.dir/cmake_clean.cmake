@@ -0,0 +1,82 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/xam.dir/alloc_count.cpp.o"
+  "CMakeFiles/xam.dir/alloc_count.cpp.o.d"
+  "CMakeFiles/xam.dir/an_ode.cpp.o"
+  "CMakeFiles/xam.dir/an_ode.cpp.o.d"
+  "CMakeFiles/xam.dir/bench_env.cpp.o"
+  "CMakeFiles/xam.dir/bench_env.cpp.o.d"
+  "CMakeFiles/xam.dir/break_even.cpp.o"
+  "CMakeFiles/xam.dir/break_even.cpp.o.d"
+  "CMakeFiles/xam.dir/cache_info.cpp.o"
+  "CMakeFiles/xam.dir/cache_info.cpp.o.d"
+  "CMakeFiles/xam.dir/case_sample.cpp.o"
+  "CMakeFiles/xam.dir/case_sample.cpp.o.d"
+  "CMakeFiles/xam.dir/cold_start.cpp.o"
+  "CMakeFiles/xam.dir/cold_start.cpp.o.d"
+  "CMakeFiles/xam.dir/count_scalar.cpp.o"
+  "CMakeFiles/xam.dir/count_scalar.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_append.cpp.o"
+  "CMakeFiles/xam.dir/csv_append.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_cold_start.cpp.o"
+  "CMakeFiles/xam.dir/csv_cold_start.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_latency.cpp.o"
+  "CMakeFiles/xam.dir/csv_latency.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_read.cpp.o"
+  "CMakeFiles/xam.dir/csv_read.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_scan.cpp.o"
+  "CMakeFiles/xam.dir/csv_scan.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_speed.cpp.o"
+  "CMakeFiles/xam.dir/csv_speed.cpp.o.d"
+  "CMakeFiles/xam.dir/csv_write.cpp.o"
+  "CMakeFiles/xam.dir/csv_write.cpp.o.d"
+  "CMakeFiles/xam.dir/det_by_minor.cpp.o"
+  "CMakeFiles/xam.dir/det_by_minor.cpp.o.d"
+  "CMakeFiles/xam.dir/det_of_minor.cpp.o"
+  "CMakeFiles/xam.dir/det_of_minor.cpp.o.d"
+  "CMakeFiles/xam.dir/fun_compare.cpp.o"
+  "CMakeFiles/xam.dir/fun_compare.cpp.o.d"
+  "CMakeFiles/xam.dir/fun_obj.cpp.o"
+  "CMakeFiles/xam.dir/fun_obj.cpp.o.d"
+  "CMakeFiles/xam.dir/fun_speed.cpp.o"
+  "CMakeFiles/xam.dir/fun_speed.cpp.o.d"
+  "CMakeFiles/xam.dir/jit_lib.cpp.o"
+  "CMakeFiles/xam.dir/jit_lib.cpp.o.d"
+  "CMakeFiles/xam.dir/latency_histogram.cpp.o"
+  "CMakeFiles/xam.dir/latency_histogram.cpp.o.d"
+  "CMakeFiles/xam.dir/llsq_obj.cpp.o"
+  "CMakeFiles/xam.dir/llsq_obj.cpp.o.d"
+  "CMakeFiles/xam.dir/mann_whitney.cpp.o"
+  "CMakeFiles/xam.dir/mann_whitney.cpp.o.d"
+  "CMakeFiles/xam.dir/near_equal.cpp.o"
+  "CMakeFiles/xam.dir/near_equal.cpp.o.d"
+  "CMakeFiles/xam.dir/perf_counter.cpp.o"
+  "CMakeFiles/xam.dir/perf_counter.cpp.o.d"
+  "CMakeFiles/xam.dir/phase_timer.cpp.o"
+  "CMakeFiles/xam.dir/phase_timer.cpp.o.d"
+  "CMakeFiles/xam.dir/results_query.cpp.o"
+  "CMakeFiles/xam.dir/results_query.cpp.o.d"
+  "CMakeFiles/xam.dir/results_store.cpp.o"
+  "CMakeFiles/xam.dir/results_store.cpp.o.d"
+  "CMakeFiles/xam.dir/runge_kutta.cpp.o"
+  "CMakeFiles/xam.dir/runge_kutta.cpp.o.d"
+  "CMakeFiles/xam.dir/sample_profiler.cpp.o"
+  "CMakeFiles/xam.dir/sample_profiler.cpp.o.d"
+  "CMakeFiles/xam.dir/speed_clock.cpp.o"
+  "CMakeFiles/xam.dir/speed_clock.cpp.o.d"
+  "CMakeFiles/xam.dir/speed_stat.cpp.o"
+  "CMakeFiles/xam.dir/speed_stat.cpp.o.d"
+  "CMakeFiles/xam.dir/static_fun.cpp.o"
+  "CMakeFiles/xam.dir/static_fun.cpp.o.d"
+  "CMakeFiles/xam.dir/trace_event.cpp.o"
+  "CMakeFiles/xam.dir/trace_event.cpp.o.d"
+  "CMakeFiles/xam.dir/uniform_01.cpp.o"
+  "CMakeFiles/xam.dir/uniform_01.cpp.o.d"
+  "libxam.pdb"
+  "libxam.so"
+  "libxam.so.2024.9.30"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/xam.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -12,7 +12,7 @@
    @Package@       , Adept
    @#######@       , #####
    @package@       , adept
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , true
 }
 
@@ -91,7 +91,9 @@ public:
       algo_ = new Algo<ADVector>();
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_->setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_->domain();
@@ -99,6 +101,20 @@ public:
       // g_
       g_.resize(n);
    }
+   // stats
+   // the statements recorded by the most recent gradient evaluation
+   tape_stats_t stats(void) const override
+   {  tape_stats_t result;
+      if( stack_ != nullptr )
+      {  result.n_op       = double( stack_->n_statements() );
+         result.n_var      = double( stack_->max_gradients() );
+         result.tape_bytes = double( stack_->memory() );
+         result.work_bytes = double(
+            stack_->max_gradients() * sizeof(::adept::Real)
+         );
+      }
+      return result;
+   }
    // domain
    size_t domain(void) const override
    {  return algo_->domain(); };
@@ -12,7 +12,7 @@
    @Package@       , ADOL-C
    @#######@       , ######
    @package@       , adolc
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , true
 }
 
@@ -68,7 +68,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -81,6 +83,7 @@ public:
       //
       // ax
       // independent variables
+      cmpad::phase_timer record_phase("record");
       int keep = 0;
       trace_on(tag_, keep);
       ADVector ax(n);
@@ -95,6 +98,7 @@ public:
       double f;
       ay[m-1] >>= f;
       trace_off();
+      record_phase.stop();
       //
       // u_
       u_.resize(1);
@@ -103,6 +107,21 @@ public:
       // g_
       g_.resize(n);
    }
+   // stats
+   tape_stats_t stats(void) const override
+   {  size_t count[STAT_SIZE];
+      tapestats(short(tag_), count);
+      tape_stats_t result;
+      result.n_op       = double( count[NUM_OPERATIONS] );
+      result.n_var      = double( count[NUM_MAX_LIVES] );
+      result.tape_bytes = double(
+         count[NUM_OPERATIONS] * sizeof(unsigned char) +
+         count[NUM_LOCATIONS]  * sizeof(locint)        +
+         count[NUM_VALUES]     * sizeof(double)
+      );
+      result.work_bytes = double( count[TAY_STACK_SIZE] * sizeof(double) );
+      return result;
+   }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
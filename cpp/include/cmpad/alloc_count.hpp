@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_ALLOC_COUNT_HPP
+# define CMPAD_ALLOC_COUNT_HPP
+
+# include <cstddef>
+namespace cmpad {
+   class alloc_count {
+   public:
+      static bool   enabled(void);
+      static size_t n_alloc(void);
+      static size_t n_byte(void);
+      static double max_rss(void);
+   };
+}
+
+# endif
@@ -12,7 +12,7 @@
    @Package@       , autodiff
    @#######@       , ########
    @package@       , autodiff
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , true
 }
 
@@ -70,7 +70,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n, m
       size_t n = algo_.domain();
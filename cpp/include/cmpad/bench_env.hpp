@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_BENCH_ENV_HPP
+# define CMPAD_BENCH_ENV_HPP
+
+# include <string>
+# include <limits>
+namespace cmpad {
+   // BEGIN BENCH_ENV_T
+   struct bench_env_t {
+      int         cpu;
+      std::string governor;
+      std::string turbo;
+      double      load_avg;
+      bench_env_t(void)
+      {  cpu      = -1;
+         load_avg = std::numeric_limits<double>::quiet_NaN();
+      }
+   };
+   // END BENCH_ENV_T
+   bool        pin_cpu(int cpu);
+   bench_env_t bench_env(int cpu);
+   std::string bench_warning(const bench_env_t& env);
+   void        rusage_count(double& ctx_switch, double& page_fault);
+}
+
+# endif
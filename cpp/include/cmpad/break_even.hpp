@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_BREAK_EVEN_HPP
+# define CMPAD_BREAK_EVEN_HPP
+
+# include <cmpad/speed_result_t.hpp>
+namespace cmpad {
+   double break_even(const speed_result_t& speed, const speed_result_t& base);
+}
+
+# endif
@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CACHE_INFO_HPP
+# define CMPAD_CACHE_INFO_HPP
+
+# include <cstddef>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   const cmpad::vector<size_t>& cache_size(void);
+   size_t                       cache_level(double n_byte);
+   void                         flush_cache(void);
+}
+
+# endif
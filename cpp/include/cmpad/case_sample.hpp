@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CASE_SAMPLE_HPP
+# define CMPAD_CASE_SAMPLE_HPP
+
+# include <map>
+# include <string>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   // BEGIN CASE_SAMPLE_T
+   typedef cmpad::vector<std::string>                     case_key_t;
+   typedef std::map< case_key_t, cmpad::vector<double> > case_sample_t;
+   // END CASE_SAMPLE_T
+   const cmpad::vector<std::string>& case_key_name(void);
+   std::string case_sample(
+      const std::string&         file_name ,
+      case_sample_t&             sample    ,
+      cmpad::vector<case_key_t>& order
+   );
+}
+
+# endif
@@ -18,7 +18,7 @@
    @Package@       , CoDiPack
    @#######@       , ########
    @package@       , codi
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , false
 }
 
@@ -82,7 +82,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -200,7 +202,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -223,6 +227,7 @@ public:
          ax_[j] = 0.0;
       //
       // tape_
+      cmpad::phase_timer record_phase("record");
       tape_.reset();
       tape_.setActive();
       for(size_t j = 0; j < n; ++j)
@@ -236,6 +241,19 @@ public:
       // tape_
       tape_.registerOutput(az_);
       tape_.setPassive();
+      record_phase.stop();
+   }
+   // stats
+   tape_stats_t stats(void) const override
+   {  tape_stats_t result;
+      result.n_op  = double(
+         tape_.getParameter( ::codi::TapeParameters::StatementSize )
+      );
+      result.n_var = double(
+         tape_.getParameter( ::codi::TapeParameters::LargestIdentifier )
+      );
+      result.tape_bytes = double( tape_.getTapeValues().getUsedMemorySize() );
+      return result;
    }
    // domain
    size_t domain(void) const override
@@ -314,6 +332,13 @@ public:
       else
          onetape_.setup(option);
    }
+   // stats
+   // the retape version clears its tape after each gradient evaluation
+   tape_stats_t stats(void) const override
+   {  if( time_setup_ )
+         return retape_.stats();
+      return onetape_.stats();
+   }
    // domain
    size_t domain(void) const override
    {  size_t result;
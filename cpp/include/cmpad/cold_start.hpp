@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_COLD_START_HPP
+# define CMPAD_COLD_START_HPP
+
+# include <limits>
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+# include <cmpad/option_t.hpp>
+namespace cmpad {
+   // BEGIN COLD_START_T
+   struct cold_start_t {
+      double time_load;
+      double time_setup;
+      double time_eval;
+      double time_total;
+      bool   correct;
+      cold_start_t(void)
+      {  double nan = std::numeric_limits<double>::quiet_NaN();
+         time_load  = nan;
+         time_setup = nan;
+         time_eval  = nan;
+         time_total = nan;
+         correct    = false;
+      }
+   };
+   // END COLD_START_T
+   bool         cold_start_child(void);
+   int          cold_start_exec(char* argv[]);
+   cold_start_t cold_start(
+      fun_obj< cmpad::vector<double> >& test_obj    ,
+      fun_obj< cmpad::vector<double> >& algo_obj    ,
+      bool                              is_gradient ,
+      const option_t&                   option
+   );
+}
+
+# endif
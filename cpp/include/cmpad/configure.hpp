@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2023-24 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_TYPEDEF_HPP
+# define CMPAD_TYPEDEF_HPP
+/*
+{xrst_begin configure}
+{xrst_spell
+   cmake
+   preprocessor
+   std
+}
+
+Preprocessor Definitions and Configured Types
+#############################################
+
+CMPAD_VERSION
+The cmpad version number (i.e. date) as a quoted string.
+
+CMPAD_PROJECT_DIR
+*****************
+The cmpad top source directory as a C-string; i.e., its project directory.
+
+CMPAD_CXX_COMPILER
+******************
+This preprocessor symbol
+is a quoted string containing a name of that identifies the C++ compiler
+that CMake chooses; e.g., ``"GNU-13.1.1"`` .
+
+CMPAD_HAS_package
+*****************
+For *package* equal to
+ADEPT, ADOLC, AUTODIFF, CLAD, CODI, CPPAD, CPPAD_JIT, CPPADCG, SACADO,
+this preprocessor symbol is one (zero) if *package* has been installed
+using bin/get_package.sh; e.g,
+{xrst_code sh}
+   bin/get_package.sh adolc
+{xrst_code}
+
+CMPAD_VECTOR_STD
+****************
+This symbol is one (zero) if
+``-D cmpad_vector=std``
+is specified on the cmake command line.
+
+CMPAD_VECTOR_CPPAD
+******************
+This symbol is one (zero) if
+``-D cmpad_vector=cppad``
+is present on the cmake command line.
+
+CMPAD_ALLOC_COUNT
+*****************
+This symbol is one (zero) if
+``-D cmpad_alloc_count=YES``
+is (is not) present on the cmake command line.
+If it is one, the global operator new is replaced so that
+heap allocations can be counted; see :ref:`alloc_count-name` .
+
+{xrst_end configure}
+*/
+
+// CMPAD_VERSION
+# define CMPAD_VERSION "2024.9.30"
+
+// CMPAD_PROJECT_DIR
+# define CMPAD_PROJECT_DIR "/root/repo/cpp"
+
+// CMPAD_CXX_COMPILER
+# define CMPAD_CXX_COMPILER \
+   "GNU-12.2.0"
+
+// CMPAD_HAS_package
+# define CMPAD_HAS_ADEPT       0
+# define CMPAD_HAS_ADOLC       0
+# define CMPAD_HAS_AUTODIFF    0
+# define CMPAD_HAS_CLAD        0
+# define CMPAD_HAS_CODI        0
+# define CMPAD_HAS_CPPAD       0
+# define CMPAD_HAS_CPPAD_JIT   0
+# define CMPAD_HAS_CPPADCG     0
+# define CMPAD_HAS_SACADO      0
+# define CMPAD_HAS_XAD         0
+
+// CMPAD_COMPILER_IS_compiler
+# define CMPAD_COMPILER_IS_CLANG 0
+# define CMPAD_COMPILER_IS_GNU   1
+# define CMPAD_COMPILER_IS_MSVC  0
+
+// CMPAD_VECOR_vector_type
+# define CMPAD_VECTOR_STD     1
+# define CMPAD_VECTOR_CPPAD   0
+
+// CMPAD_ALLOC_COUNT
+# define CMPAD_ALLOC_COUNT    0
+
+# endif
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_COUNT_SCALAR_HPP
+# define CMPAD_COUNT_SCALAR_HPP
+/*
+{xrst_begin count_scalar}
+{xrst_spell
+   algo
+   neg
+   struct
+}
+
+A Scalar Type That Counts Floating Point Operations
+###################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/count_scalar.hpp>``
+| |tab| ``cmpad::count_scalar`` *s* ( *value* )
+| |tab| *value* = *s* . ``value`` ()
+| |tab| ``cmpad::count_scalar::clear`` ()
+| |tab| *count* = ``cmpad::count_scalar::count`` ()
+| |tab| *count* = ``cmpad::op_count`` < *Algo* > ( *option* )
+
+Purpose
+*******
+The :ref:`cpp_algo-name` are templates on a *Vector* type
+whose elements support the ``+ - * /`` operators.
+Using ``count_scalar`` for the elements, and computing the algorithm once,
+gives an exact count of the floating point operations for an
+:ref:`option_t-name` value.
+Dividing this by the seconds for one computation gives the
+achieved floating point operations per second.
+
+s
+*
+A ``count_scalar`` object *s* holds a ``double`` *value* .
+It can be constructed from, and assigned, a ``double`` value
+and the default value is zero.
+The binary operators ``+ - * /`` ,
+the compound assignment operators ``+= -= *= /=`` ,
+unary minus, and the comparison operators are defined for
+``count_scalar`` operands.
+An operand can also be a ``double`` .
+
+clear
+*****
+This routine sets all the counts to zero.
+
+count
+*****
+The return value has type ``const op_count_t&`` where
+{xrst_literal
+   // BEGIN OP_COUNT_T
+   // END OP_COUNT_T
+}
+The field *add* is the number of additions
+(including ``+=`` ) since the last call to ``clear`` .
+The fields *sub* , *mul* , *div* are the same for subtraction,
+multiplication, and division.
+The field *neg* is the number of unary minus operations and
+*compare* is the number of comparisons.
+The function *n_flop* returns the number of floating point operations;
+i.e., the sum of all the fields except *compare* .
+
+Thread Safety
+=============
+The counts are shared by all ``count_scalar`` objects and
+are not thread safe.
+
+op_count
+********
+This routine returns the *count* for one computation of an algorithm
+(not including its setup).
+
+Algo
+====
+This is a template class, with one *Vector* template argument,
+that is derived from :ref:`cpp_fun_obj-name` ; e.g.,
+``cmpad::det_by_minor`` .
+The algorithm is computed using ``cmpad::vector<count_scalar>``
+for its *Vector* .
+
+option
+======
+This :ref:`option_t-name` object is used to setup the algorithm.
+The argument vector is random values between zero and one.
+The count does not depend on the argument values,
+because none of the cmpad algorithms branch on their argument values.
+
+{xrst_toc_hidden
+   cpp/xam/count_scalar.cpp
+}
+Example
+*******
+:ref:`xam_count_scalar.cpp-name` contains an example and test of this class.
+
+{xrst_end count_scalar}
+-------------------------------------------------------------------------------
+*/
+# include <cstddef>
+# include <cmpad/vector.hpp>
+# include <cmpad/option_t.hpp>
+# include <cmpad/uniform_01.hpp>
+
+namespace cmpad {
+   // BEGIN OP_COUNT_T
+   struct op_count_t {
+      size_t add;
+      size_t sub;
+      size_t mul;
+      size_t div;
+      size_t neg;
+      size_t compare;
+      op_count_t(void)
+      : add(0), sub(0), mul(0), div(0), neg(0), compare(0)
+      { }
+      size_t n_flop(void) const
+      {  return add + sub + mul + div + neg; }
+   };
+   // END OP_COUNT_T
+   //
+   // count_scalar
+   class count_scalar {
+   private:
+      double value_;
+      //
+      // counter_
+      static op_count_t& counter_(void)
+      {  static op_count_t counter;
+         return counter;
+      }
+   public:
+      // clear
+      static void clear(void)
+      {  counter_() = op_count_t(); }
+      //
+      // count
+      static const op_count_t& count(void)
+      {  return counter_(); }
+      //
+      // constructors
+      count_scalar(void) : value_(0.0)
+      { }
+      count_scalar(double value) : value_(value)
+      { }
+      //
+      // value
+      double value(void) const
+      {  return value_; }
+      //
+      // compound assignment
+      count_scalar& operator+=(const count_scalar& right)
+      {  ++counter_().add;
+         value_ += right.value_;
+         return *this;
+      }
+      count_scalar& operator-=(const count_scalar& right)
+      {  ++counter_().sub;
+         value_ -= right.value_;
+         return *this;
+      }
+      count_scalar& operator*=(const count_scalar& right)
+      {  ++counter_().mul;
+         value_ *= right.value_;
+         return *this;
+      }
+      count_scalar& operator/=(const count_scalar& right)
+      {  ++counter_().div;
+         value_ /= right.value_;
+         return *this;
+      }
+      //
+      // unary
+      count_scalar operator+(void) const
+      {  return *this; }
+      count_scalar operator-(void) const
+      {  ++counter_().neg;
+         return count_scalar( - value_ );
+      }
+      //
+      // binary
+      friend count_scalar operator+(
+         const count_scalar& left, const count_scalar& right
+      )
+      {  ++counter_().add;
+         return count_scalar( left.value_ + right.value_ );
+      }
+      friend count_scalar operator-(
+         const count_scalar& left, const count_scalar& right
+      )
+      {  ++counter_().sub;
+         return count_scalar( left.value_ - right.value_ );
+      }
+      friend count_scalar operator*(
+         const count_scalar& left, const count_scalar& right
+      )
+      {  ++counter_().mul;
+         return count_scalar( left.value_ * right.value_ );
+      }
+      friend count_scalar operator/(
+         const count_scalar& left, const count_scalar& right
+      )
+      {  ++counter_().div;
+         return count_scalar( left.value_ / right.value_ );
+      }
+      //
+      // comparison
+      friend bool operator==(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ == right.value_;
+      }
+      friend bool operator!=(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ != right.value_;
+      }
+      friend bool operator<(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ < right.value_;
+      }
+      friend bool operator<=(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ <= right.value_;
+      }
+      friend bool operator>(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ > right.value_;
+      }
+      friend bool operator>=(const count_scalar& left, const count_scalar& right)
+      {  ++counter_().compare;
+         return left.value_ >= right.value_;
+      }
+   };
+   //
+   // op_count
+   template <template <class Vector> class Algo>
+   op_count_t op_count(const option_t& option)
+   {  //
+      // algo
+      Algo< cmpad::vector<count_scalar> > algo;
+      algo.setup(option);
+      //
+      // x
+      size_t n = algo.domain();
+      cmpad::vector<double>       x_double(n);
+      cmpad::vector<count_scalar> x(n);
+      uniform_01(x_double);
+      for(size_t i = 0; i < n; ++i)
+         x[i] = x_double[i];
+      //
+      // count
+      count_scalar::clear();
+      algo(x);
+      op_count_t count = count_scalar::count();
+      count_scalar::clear();
+      //
+      return count;
+   }
+}
+
+# endif
@@ -20,7 +20,7 @@ Gradients Using CppAD
    @Package@       , CppAD
    @#######@       , #####
    @package@       , cppad
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , true
 }
 {xrst_end cppad_gradient.hpp}
@@ -104,7 +104,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -124,17 +126,32 @@ public:
       ADVector ax(n);
       for(size_t i = 0; i < n; ++i)
          ax[i] = 0.;
+      cmpad::phase_timer record_phase("record");
       CppAD::Independent(ax);
       ADVector ay(1), az;
       az    = algo_(ax);
       ay[0] = az[m-1];
       tape_.Dependent(ax, ay);
+      record_phase.stop();
       if( ! option.time_setup )
+      {  cmpad::phase_timer optimize_phase("optimize");
          tape_.optimize(optimize_options);
+      }
       //
       // g_
       g_.resize(n);
    }
+   // stats
+   tape_stats_t stats(void) const override
+   {  tape_stats_t result;
+      result.n_op       = double( tape_.size_op() );
+      result.n_var      = double( tape_.size_var() );
+      result.tape_bytes = double( tape_.size_op_seq() );
+      result.work_bytes = double(
+         tape_.size_var() * tape_.size_order() * sizeof(double)
+      );
+      return result;
+   }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
@@ -210,7 +227,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -230,19 +249,32 @@ public:
       ADVector ax(n);
       for(size_t i = 0; i < n; ++i)
          ax[i] = 0.;
+      cmpad::phase_timer record_phase("record");
       CppAD::Independent(ax);
       ADVector ay(1), az;
       az    = algo_(ax);
       ay[0] = az[m-1];
       tape_.Dependent(ax, ay);
+      record_phase.stop();
       if( ! option.time_setup )
+      {  cmpad::phase_timer optimize_phase("optimize");
          tape_.optimize(optimize_options);
+      }
       //
       // x_, g_, g_dbl_
       x_.resize(n);
       g_.resize(n);
       g_dbl_.resize(n);
    }
+   // stats
+   // the work space for valvector depends on the size of its vectors
+   tape_stats_t stats(void) const override
+   {  tape_stats_t result;
+      result.n_op       = double( tape_.size_op() );
+      result.n_var      = double( tape_.size_var() );
+      result.tape_bytes = double( tape_.size_op_seq() );
+      return result;
+   }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
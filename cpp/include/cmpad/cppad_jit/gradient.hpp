@@ -6,17 +6,13 @@
 # define CMPAD_CPPAD_JIT_GRADIENT_HPP
 /*
 {xrst_begin cppad_jit_gradient.hpp}
-{xrst_spell
-   dll
-   ext
-}
 
 {xrst_template ,
    cpp/include/cmpad/gradient.xrst
    @Package@       , CppAD Jit
    @#######@       , #########
    @package@       , cppad_jit
-   @not_cppad_jit@ , false
+   @not_jit@       , false
    @not_codi@      , true
 }
 
@@ -27,6 +23,7 @@
 
 # include <filesystem>
 # include <cmpad/gradient.hpp>
+# include <cmpad/jit_lib.hpp>
 # include <cmpad/cppad/cppad.hpp>
 
 # ifdef _WIN32
@@ -67,6 +64,14 @@ private:
    //
    // grad_cppad_jit_
    CppAD::jit_double                 grad_cppad_jit_;
+   //
+   // stats_
+   // statistics for the gradient tape that is compiled
+   tape_stats_t                      stats_;
+   //
+   // jit_dir_
+   // directory for the library (empty before the first setup)
+   std::filesystem::path             jit_dir_;
 //
 public:
    // ctor, dtor
@@ -75,6 +80,8 @@ public:
    ~gradient(void)
    {  if( dll_linker_ != nullptr )
          delete dll_linker_;
+      if( ! jit_dir_.empty() )
+         cmpad::jit_lib::release_dir(jit_dir_);
    }
    // scalar_type
    typedef double scalar_type;
@@ -95,7 +102,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -118,16 +127,22 @@ public:
       //
       // tapef
       CppAD::ADFun<double> tapef;
+      cmpad::phase_timer record_phase("record");
       for(size_t i = 0; i < n; ++i)
          ax[i] = 0.;
       CppAD::Independent(ax);
       az    = algo_(ax);
       ay[0] = az[m-1];
       tapef.Dependent(ax, ay);
+      record_phase.stop();
       if( ! option.time_setup )
+      {  cmpad::phase_timer optimize_phase("optimize");
          tapef.optimize(optimize_options);
+      }
       //
       // atapef
+      // re-recording the gradient is included in the base2ad phase
+      cmpad::phase_timer base2ad_phase("base2ad");
       CppAD::ADFun< ADScalar, double > atapef;
       atapef = tapef.base2ad();
       //
@@ -141,8 +156,16 @@ public:
       CppAD::ADFun<double> tapeg;
       tapeg.Dependent(ax, ag);
       tapeg.function_name_set(function_name);
+      base2ad_phase.stop();
       if( ! option.time_setup )
+      {  cmpad::phase_timer optimize_phase("optimize");
          tapeg.optimize(optimize_options);
+      }
+      //
+      // stats_
+      stats_.n_op       = double( tapeg.size_op() );
+      stats_.n_var      = double( tapeg.size_var() );
+      stats_.tape_bytes = double( tapeg.size_op_seq() );
       //
       // path
       using std::filesystem::path;
@@ -150,17 +173,28 @@ public:
       // original_path
       path original_path = std::filesystem::current_path();
       //
-      // current_path
-      path temp_path = std::filesystem::temp_directory_path();
-      std::filesystem::current_path(temp_path);
+      // dll_linker_
+      // the previous library is closed before it is replaced
+      if( dll_linker_ != nullptr )
+      {  delete dll_linker_;
+         dll_linker_ = nullptr;
+      }
+      //
+      // jit_dir_, current_path
+      // one directory for each function object
+      if( jit_dir_.empty() )
+         jit_dir_ = cmpad::jit_lib::new_dir("cppad_jit");
+      std::filesystem::current_path(jit_dir_);
       //
       // csrc_file
       string type = "double";
       string csrc_file = function_name + ".c";
+      cmpad::phase_timer to_csrc_phase("to_csrc");
       std::ofstream ofs;
       ofs.open(csrc_file, std::ofstream::out);
       tapeg.to_csrc(ofs, type);
       ofs.close();
+      to_csrc_phase.stop();
       //
       // dll_file
       string  dll_file = function_name + CMPAD_DLL_EXT;
@@ -183,8 +217,10 @@ public:
       dll_options["compile"] = "clang -c -O2 -fPIC";
 # endif
 # endif
+      cmpad::phase_timer compile_phase("compile");
       string err_msg =
          CppAD::create_dll_lib(dll_file, csrc_files, dll_options);
+      compile_phase.stop();
       if( err_msg != "" )
       {  std::cerr << "cppad_jit::gradient::setup: err_msg = ";
          std::cerr << err_msg << "\n";
@@ -198,8 +234,7 @@ public:
       }
       //
       // dll_linker_
-      if( dll_linker_ != nullptr )
-         delete dll_linker_;
+      cmpad::phase_timer load_phase("load");
       if( dll_file != "" )
       {  dll_linker_ = new CppAD::link_dll_lib(dll_file, err_msg);
          if( err_msg != "" )
@@ -222,10 +257,17 @@ public:
          }
       }
       grad_cppad_jit_ = reinterpret_cast<CppAD::jit_double>(void_ptr);
+      load_phase.stop();
+      //
+      // perf map
+      cmpad::jit_lib::perf_map(jit_dir_);
       //
       // current_path
       std::filesystem::current_path(original_path);
    }
+   // stats
+   tape_stats_t stats(void) const override
+   {  return stats_; }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
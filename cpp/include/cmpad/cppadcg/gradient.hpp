@@ -15,7 +15,7 @@
    @Package@       , CppAD CodeGen
    @#######@       , #############
    @package@       , cppadcg
-   @not_cppad_jit@ , true
+   @not_jit@       , false
    @not_codi@      , true
 }
 
@@ -26,6 +26,7 @@
 
 # include <filesystem>
 # include <cmpad/gradient.hpp>
+# include <cmpad/jit_lib.hpp>
 # include <cmpad/cppad/cppad.hpp>
 
 namespace cmpad { namespace cppadcg { // BEGIN cmpad::cppadcg namespace
@@ -55,10 +56,25 @@ private:
    // model_
    std::unique_ptr< CppAD::cg::GenericModel<double> > model_;
    //
+   // stats_
+   // statistics for the function tape that code is generated from
+   tape_stats_t                                       stats_;
+   //
    // g_
    cmpad::vector<double>                              g_;
+   //
+   // jit_dir_
+   // directory for the library (empty before the first setup)
+   std::filesystem::path                              jit_dir_;
 //
 public:
+   // dtor
+   ~gradient(void)
+   {  model_       = nullptr;
+      dynamic_lib_ = nullptr;
+      if( ! jit_dir_.empty() )
+         cmpad::jit_lib::release_dir(jit_dir_);
+   }
    // scalar_type
    typedef double scalar_type;
    //
@@ -83,7 +99,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -100,13 +118,22 @@ public:
       ADVector ax(n);
       for(size_t i = 0; i < n; ++i)
          ax[i] = 0.;
+      cmpad::phase_timer record_phase("record");
       CppAD::Independent(ax);
       ADVector ay(1), az;
       az    = algo_(ax);
       ay[0] = az[m-1];
       tape.Dependent(ax, ay);
+      record_phase.stop();
       if( ! option.time_setup )
+      {  cmpad::phase_timer optimize_phase("optimize");
          tape.optimize(optimize_options);
+      }
+      //
+      // stats_
+      stats_.n_op       = double( tape.size_op() );
+      stats_.n_var      = double( tape.size_var() );
+      stats_.tape_bytes = double( tape.size_op_seq() );
       //
       // path
       using std::filesystem::path;
@@ -114,11 +141,21 @@ public:
       // original_path
       path original_path = std::filesystem::current_path();
       //
-      // current_path
-      path temp_path = std::filesystem::temp_directory_path();
-      std::filesystem::current_path(temp_path);
+      // model_, dynamic_lib_
+      // the previous library is closed before it is replaced
+      model_       = nullptr;
+      dynamic_lib_ = nullptr;
+      //
+      // jit_dir_, current_path
+      // one directory for each function object
+      if( jit_dir_.empty() )
+         jit_dir_ = cmpad::jit_lib::new_dir("cppadcg");
+      std::filesystem::current_path(jit_dir_);
       //
       // cgen
+      // CppADCodeGen generates the source code during createDynamicLibrary,
+      // so the compile phase also includes generating the source code.
+      cmpad::phase_timer compile_phase("compile");
       CppAD::cg::ModelCSourceGen<double> cgen(tape, "model");
       cgen.setCreateJacobian(true);
       //
@@ -126,17 +163,27 @@ public:
       CppAD::cg::ModelLibraryCSourceGen<double> libcgen(cgen);
       //
       // dynamic_lib_
-      CppAD::cg::DynamicModelLibraryProcessor<double> proc(libcgen);
-      dynamic_lib_ = nullptr;
+      path lib_name = jit_dir_ / "cppad_cg_model";
+      CppAD::cg::DynamicModelLibraryProcessor<double> proc(
+         libcgen, lib_name.string()
+      );
       dynamic_lib_ = proc.createDynamicLibrary(compiler);
+      compile_phase.stop();
       //
       // model_
-      model_ = nullptr;
+      cmpad::phase_timer load_phase("load");
       model_ = dynamic_lib_->model("model");
+      load_phase.stop();
+      //
+      // perf map
+      cmpad::jit_lib::perf_map(jit_dir_);
       //
       // current_path
       std::filesystem::current_path(original_path);
    }
+   // stats
+   tape_stats_t stats(void) const override
+   {  return stats_; }
    // domain
    size_t domain(void) const override
    {  return algo_.domain(); };
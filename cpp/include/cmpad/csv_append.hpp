@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CSV_APPEND_HPP
+# define CMPAD_CSV_APPEND_HPP
+
+# include <string>
+# include <cmpad/vec_vec_str.hpp>
+namespace cmpad {
+   class csv_append {
+   public:
+      static void enable_fsync(bool on);
+      static bool fsync_enabled(void);
+      static bool rows(
+         const std::string&                file_name ,
+         const cmpad::vector<std::string>& col_name  ,
+         const vec_vec_str&                row_vec   ,
+         bool                              extend
+      );
+   };
+}
+
+# endif
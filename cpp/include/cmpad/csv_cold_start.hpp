@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CSV_COLD_START_HPP
+# define CMPAD_CSV_COLD_START_HPP
+
+# include <string>
+# include <cmpad/option_t.hpp>
+# include <cmpad/cold_start.hpp>
+
+namespace cmpad {
+   void csv_cold_start(
+      const std::string&       file_name ,
+      const cold_start_t&      cold      ,
+      const std::string&       package   ,
+      const std::string&       algorithm ,
+      bool                     special   ,
+      const option_t&          option
+   );
+}
+
+# endif
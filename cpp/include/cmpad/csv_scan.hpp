@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_CSV_SCAN_HPP
+# define CMPAD_CSV_SCAN_HPP
+
+# include <cstddef>
+# include <string>
+# include <string_view>
+# include <functional>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   // BEGIN CSV_CALLBACK_T
+   typedef std::function<
+      bool(size_t index, const cmpad::vector<std::string_view>& row)
+   > csv_callback_t;
+   // END CSV_CALLBACK_T
+   bool csv_scan(const std::string& file_name, const csv_callback_t& callback);
+   void csv_scan_text(std::string_view text, const csv_callback_t& callback);
+}
+
+# endif
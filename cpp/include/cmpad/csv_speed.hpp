@@ -7,8 +7,18 @@
 
 # include <string>
 # include <cmpad/option_t.hpp>
+# include <cmpad/speed_result_t.hpp>
 
 namespace cmpad {
+   void csv_speed(
+      const std::string&    file_name ,
+      const speed_result_t& speed     ,
+      double                min_time  ,
+      const std::string&    package   ,
+      const std::string&    algorithm ,
+      bool                  special   ,
+      const option_t&       option
+   );
    void csv_speed(
       const std::string& file_name ,
       double             rate      ,
@@ -5,11 +5,13 @@
 # ifndef CMPAD_CSV_WRITE_HPP
 # define CMPAD_CSV_WRITE_HPP
 
+# include <string>
 # include <cmpad/vec_vec_str.hpp>
 namespace cmpad {
    void csv_write(
       const std::string& file_name  , const vec_vec_str& csv_table
    );
+   std::string csv_field(const std::string& value);
 }
 
 # endif
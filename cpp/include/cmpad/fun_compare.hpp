@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_FUN_COMPARE_HPP
+# define CMPAD_FUN_COMPARE_HPP
+
+# include <cmpad/vector.hpp>
+# include <cmpad/fun_obj.hpp>
+# include <cmpad/option_t.hpp>
+# include <cmpad/speed_option_t.hpp>
+# include <cmpad/speed_result_t.hpp>
+
+namespace cmpad {
+   cmpad::vector<speed_result_t> fun_compare(
+      const cmpad::vector< fun_obj< cmpad::vector<double> >* >& fun_vec ,
+      const option_t&                                          option  ,
+      double                                                   min_time,
+      const speed_option_t&                                    speed_option
+   );
+}
+
+# endif
@@ -18,12 +18,15 @@ Syntax
 | |tab| ``# include <cmpad/fun_speed.hpp>``
 | |tab| *y* = *fun_obj* ( *x* )
 | |tab| *rate* = ``cmpad::fun_speed`` ( *fun_obj*, *option*, *min_time* )
+| |tab| *speed* = ``cmpad::fun_speed`` (
+| |tab| |tab| *fun_obj*, *option*, *min_time*, *speed_option*
+| |tab| )
 
 Prototype
 *********
-{xrst_literal
-   // BEGIN PROTOTYPE
-   // END PROTOTYPE
+{xrst_literal ,
+   // BEGIN PROTOTYPE, // END PROTOTYPE
+   // BEGIN SAMPLE PROTOTYPE, // END SAMPLE PROTOTYPE
 }
 
 fun_obj
@@ -34,6 +37,8 @@ x
 *
 This is a ``cmpad::vector<double>`` object with size equal to the
 dimension of the :ref:`cpp_fun_obj@domain` space for the function object.
+It is an element of the pool of arguments; see
+:ref:`speed_option_t@n_pool` .
 
 y
 *
@@ -54,6 +59,7 @@ If option.time_setup is true (false) the setup function is (is not)
 included in the time for each function evaluation.
 If the setup time is not included, the only thing that changes
 between function evaluations is the argument vector *x* .
+The time to generate the argument vectors is never included.
 
 min_time
 ********
@@ -61,10 +67,150 @@ This is the minimum time in seconds for the timing of the computation.
 The computation of the function object will be repeated enough times
 so that this minimum time is reached.
 
+speed_option
+************
+This :ref:`speed_option_t-name` object determines the number of
+warm-up passes, timing samples, and argument vectors in the pool.
+
+Repeat
+======
+The number of times the function object is computed during one sample,
+*repeat* , is determined by doubling it until one pass takes at least
+*min_time* divided by *speed_option*\ ``.n_sample`` seconds.
+If *speed_option*\ ``.n_warmup`` is zero,
+the last of these passes is used as the first sample.
+Otherwise it is counted as the first warm-up pass.
+
+Convergence
+===========
+If *speed_option*\ ``.rel_error`` is greater than zero,
+more samples are taken, after the first
+*speed_option*\ ``.n_sample`` samples,
+until the :ref:`speed_result_t@rel_error` is less than or equal
+*speed_option*\ ``.rel_error`` or the time for the samples is greater
+than or equal *speed_option*\ ``.max_time`` .
+The samples are added in batches of one quarter of the current number
+of samples (at least one) and the statistics are only recomputed
+after each batch, so the cost of the statistics does not grow
+quadratically with the number of samples.
+The time budget is checked before each sample.
+In this case, *speed*\ ``.n_sample`` is the total number of samples.
+
+Clock
+=====
+All of the times are measured using the :ref:`speed_clock-name`
+specified by *speed_option*\ ``.clock`` .
+
+Sample
+======
+Each of the samples computes the function object *repeat* times.
+The corresponding sample value is the time for the pass,
+minus the overhead (see below),
+divided by *repeat* .
+
+Performance Counters
+====================
+If *speed_option*\ ``.perf_counter`` is true,
+the hardware events are counted during the passes that are samples
+(not during the warm-up passes);
+see :ref:`speed_result_t@perf_count` .
+The counters are started just before the clock is read at the start
+of each pass and stopped just after it is read at the end of the pass,
+so the counts include the loop and the clock reads
+(which are small compared to a computation).
+If *speed_option*\ ``.flush_cache`` is true,
+the counters are stopped during each flush of the caches,
+so the counts are only for the computations.
+
+Overhead
+========
+After *repeat* is determined, the time for a pass that does not
+compute the function object is measured several times.
+The minimum of these times is the overhead for reading the clock
+and for the loop; see :ref:`speed_result_t@time_overhead` .
+It is subtracted from the time for each pass before it is divided
+by *repeat* to get the corresponding sample value.
+If the time for a pass is not greater than the overhead,
+the overhead is not subtracted for that pass; see
+:ref:`speed_result_t@n_raw` .
+(Increasing *repeat* would not help because the time for a pass
+and the overhead are both proportional to *repeat* .)
+
+Cold Caches
+===========
+If *speed_option*\ ``.flush_cache`` is true,
+the :ref:`cache_info@flush_cache` routine is called before each
+computation of the function object, outside of the timing.
+In this case each computation is timed separately,
+the time for a pass is the sum of these times,
+and the overhead is measured the same way.
+The doubling of *repeat* stops when the wall clock time for a pass,
+including the time to flush the caches, is at least
+*min_time* divided by *speed_option*\ ``.n_sample`` .
+
+Latency
+=======
+If *speed_option*\ ``.latency`` is true,
+a latency pass is made after the samples.
+It computes the function object *speed*\ ``.n_sample``
+times *repeat* times and records the time for each computation in
+:ref:`speed_result_t@latency` .
+The clock :ref:`speed_clock@overhead` is subtracted from these times.
+
+Trace Events
+============
+If :ref:`trace_event@Enabled` is true, the call to fun_speed,
+the first call to setup, each pass that determines *repeat* ,
+the overhead passes, each warm-up pass, each sample, and the latency pass
+are recorded as :ref:`trace_event-name` spans with category ``fun_speed`` .
+The span for a sample has the arguments
+*repeat* and the number of context switches and page faults during the pass;
+a non-zero number of context switches means the sample may have been
+interrupted.
+The spans are started and stopped outside of the timing for each pass.
+
+Profile
+=======
+If *speed_option*\ ``.profile`` is true,
+after the timing samples, the :ref:`sample_profiler-name` is run
+during extra passes that have the same number of computations as the samples.
+These passes are not included in any of the results other than the profile.
+(The profiler samples the call stack every millisecond of processor time
+and its signal handler would change the sample times.)
+If *speed_option*\ ``.flush_cache`` is true,
+the profiler is paused during each flush of the caches;
+see :ref:`sample_profiler@pause` .
+
 rate
 ****
 This is the speed of one computation of the function object; i.e.,
 the number of times per second that the function object gets computed.
+It is the same as *speed*\ ``.rate`` when *speed_option*
+has its default value.
+
+speed
+*****
+This :ref:`speed_result_t-name` object contains the timing samples
+and the corresponding statistics; see :ref:`speed_stat-name` .
+It also contains the time for the first call to setup,
+and for each of its phases; see
+:ref:`speed_result_t@time_init` and :ref:`speed_result_t@setup_phase` .
+If the function object is a :ref:`cpp_gradient-name` object,
+it contains the :ref:`speed_result_t@tape_stats`
+and the corresponding :ref:`speed_result_t@cache_level` .
+
+Context Switches
+================
+The number of context switches and page faults from the start of the
+passes that determine *repeat* to the end of the samples are recorded;
+see :ref:`speed_result_t@ctx_switch` and :ref:`speed_result_t@page_fault` .
+
+Allocations
+===========
+If :ref:`alloc_count@on` is true,
+the heap allocations are counted during the first call to setup
+and during the passes that are samples; see
+:ref:`speed_result_t@alloc_setup` and :ref:`speed_result_t@alloc_eval` .
 
 {xrst_toc_hidden
    cpp/xam/fun_speed.cpp
@@ -76,42 +222,180 @@ Example
 {xrst_end cpp_fun_speed}
 -------------------------------------------------------------------------------
 */
+# include <cmath>
 # include <iostream>
-# include <chrono>
+# include <algorithm>
+# include <type_traits>
 # include <cmpad/uniform_01.hpp>
 # include <cmpad/option_t.hpp>
+# include <cmpad/gradient.hpp>
+# include <cmpad/alloc_count.hpp>
+# include <cmpad/bench_env.hpp>
+# include <cmpad/cache_info.hpp>
+# include <cmpad/perf_counter.hpp>
+# include <cmpad/sample_profiler.hpp>
+# include <cmpad/phase_timer.hpp>
+# include <cmpad/speed_clock.hpp>
+# include <cmpad/speed_option_t.hpp>
+# include <cmpad/speed_result_t.hpp>
+# include <cmpad/speed_stat.hpp>
+# include <cmpad/trace_event.hpp>
 
 namespace cmpad { // BEGIN cmpad namespace
 
-// BEGIN PROTOTYPE
-template <class Fun_Obj> double fun_speed(
-   Fun_Obj&         fun_obj    ,
-   const option_t&  option     ,
-   double           min_time   )
-// END PROTOTYPE
+// BEGIN SAMPLE PROTOTYPE
+template <class Fun_Obj> speed_result_t fun_speed(
+   Fun_Obj&               fun_obj      ,
+   const option_t&        option       ,
+   double                 min_time     ,
+   const speed_option_t&  speed_option )
+// END SAMPLE PROTOTYPE
 {  //
-   // steady_clock
-   using std::chrono::steady_clock;
+   // fun_span
+   trace_event fun_span("fun_speed", "fun_speed");
+   //
+   // clock
+   speed_clock clock( speed_option.clock );
    //
-   // time_point, duration
-   typedef std::chrono::time_point<steady_clock> time_point;
-   typedef std::chrono::duration<double>         duration;
+   // n_sample, n_warmup, n_pool
+   size_t n_sample = speed_option.n_sample;
+   size_t n_warmup = speed_option.n_warmup;
+   size_t n_pool   = speed_option.n_pool;
+   if( n_sample == 0 )
+   {  std::cerr << "cmpad::fun_speed: speed_option.n_sample is zero\n";
+      std::exit(1);
+   }
+   if( n_pool == 0 )
+   {  std::cerr << "cmpad::fun_speed: speed_option.n_pool is zero\n";
+      std::exit(1);
+   }
    //
-   // fun_obj.setup
+   // fun_obj.setup, time_init, alloc_setup, byte_setup, setup_phase
+   // the phase timers are only enabled during the first setup
+   phase_timer::clear();
+   phase_timer::enable(true);
+   trace_event setup_span("setup", "fun_speed");
+   size_t   alloc_init = alloc_count::n_alloc();
+   size_t   byte_init  = alloc_count::n_byte();
+   uint64_t t_init     = clock.tick();
    fun_obj.setup(option);
+   double time_init    = clock.seconds( clock.tick() - t_init );
+   double alloc_setup = double( alloc_count::n_alloc() - alloc_init );
+   double byte_setup  = double( alloc_count::n_byte() - byte_init );
+   setup_span.stop();
+   phase_timer::enable(false);
+   cmpad::vector<phase_t> setup_phase = phase_timer::phase_vec();
+   phase_timer::clear();
    //
-   // x
+   // pool
    size_t n = fun_obj.domain();
-   cmpad::vector<double> x(n);
+   cmpad::vector< cmpad::vector<double> > pool(n_pool);
+   for(size_t k = 0; k < n_pool; ++k)
+   {  pool[k].resize(n);
+      uniform_01( pool[k] );
+   }
+   //
+   // i_pool
+   // index in pool of the next argument vector
+   size_t i_pool = 0;
+   //
+   // counter
+   perf_counter counter;
+   if( speed_option.perf_counter )
+      counter.open();
    //
-   // repeat, t_start, t_end, t_diff
+   // flush
+   // the flush buffer is allocated here so it is not in the allocation counts
+   bool flush = speed_option.flush_cache;
+   if( flush )
+      flush_cache();
+   //
+   // t_wall
+   // wall clock seconds for the most recent call to time_pass
+   double t_wall = 0.0;
+   //
+   // time_pass
+   // time in seconds to compute the function object repeat times
+   // (the counter is running while the clock is read for the pass,
+   // it and the profiler are not running during the flushes)
+   auto time_pass = [&](size_t repeat)
+   {  //
+      // counter
+      counter.start();
+      //
+      // t_start
+      uint64_t t_start = clock.tick();
+      //
+      // n_tick
+      // sum of the ticks for each computation (only used when flushing)
+      uint64_t n_tick = 0;
+      //
+      // computation
+      for(size_t i = 0; i < repeat; ++i)
+      {  const cmpad::vector<double>& x = pool[i_pool];
+         if( ++i_pool == n_pool )
+            i_pool = 0;
+         if( flush )
+         {  counter.stop();
+            sample_profiler::pause(true);
+            flush_cache();
+            sample_profiler::pause(false);
+            counter.start();
+            uint64_t t_call = clock.tick();
+            if( option.time_setup )
+               fun_obj.setup(option);
+            fun_obj(x);
+            n_tick += clock.tick() - t_call;
+         }
+         else
+         {  if( option.time_setup )
+               fun_obj.setup(option);
+            fun_obj(x);
+         }
+      }
+      // t_end
+      uint64_t t_end = clock.tick();
+      //
+      // counter
+      counter.stop();
+      //
+      // t_wall
+      t_wall = clock.seconds(t_end - t_start);
+      if( flush )
+         return clock.seconds(n_tick);
+      return t_wall;
+   };
+   //
+   // speed
+   // allocated before the timing so it is not in the allocation counts
+   speed_result_t speed;
+   speed.n_warmup  = n_warmup;
+   speed.n_sample  = n_sample;
+   speed.n_pool    = n_pool;
+   speed.time_init   = time_init;
+   speed.clock       = clock.name();
+   speed.flush_cache = flush;
+   speed.setup_phase = setup_phase;
+   speed.time_sample.resize(n_sample);
+   //
+   // sample_time
+   double sample_time = min_time / double(n_sample);
+   //
+   // repeat, t_diff
    size_t     repeat  = 0;
-   time_point t_start = steady_clock::now();
-   time_point t_end   = steady_clock::now();
-   double     t_diff  = duration(t_end - t_start).count();
+   double     t_diff  = 0.0;
+   //
+   // alloc_pass, byte_pass
+   // allocation counts for the most recent pass
+   size_t alloc_pass = 0;
+   size_t byte_pass  = 0;
    //
-   // while t_diff < min_time
-   while( t_diff < min_time )
+   // ctx_start, fault_start
+   double ctx_start, fault_start;
+   rusage_count(ctx_start, fault_start);
+   //
+   // while t_wall < sample_time
+   while( t_wall < sample_time )
    {  //
       // repeat
       if( repeat == 0 )
@@ -124,22 +408,216 @@ template <class Fun_Obj> double fun_speed(
          repeat = 2 * repeat;
       }
       //
-      // t_start
-      t_start = steady_clock::now();
+      // counter, t_diff, alloc_pass, byte_pass
+      counter.reset();
+      trace_event span("calibrate", "fun_speed");
+      size_t alloc_start = alloc_count::n_alloc();
+      size_t byte_start  = alloc_count::n_byte();
+      t_diff     = time_pass(repeat);
+      alloc_pass = alloc_count::n_alloc() - alloc_start;
+      byte_pass  = alloc_count::n_byte()  - byte_start;
+      span.arg("repeat", double(repeat) );
+   }
+   //
+   // t_overhead, speed.time_overhead
+   // minimum of several empty passes
+   trace_event overhead_span("overhead", "fun_speed");
+   double t_overhead = clock.empty_pass(pool, i_pool, repeat, flush);
+   for(size_t i = 0; i < 4; ++i)
+   {  t_overhead = std::min(
+         t_overhead, clock.empty_pass(pool, i_pool, repeat, flush)
+      );
+   }
+   speed.time_overhead = t_overhead / double(repeat);
+   overhead_span.stop();
+   //
+   // sample_value, speed.n_raw
+   // seconds for one computation corresponding to a pass time
+   // (the overhead is not subtracted if that would not leave a positive time)
+   auto sample_value = [&](double t_pass)
+   {  if( t_overhead < t_pass )
+         return (t_pass - t_overhead) / double(repeat);
+      ++speed.n_raw;
+      return t_pass / double(repeat);
+   };
+   //
+   // alloc_sample, byte_sample
+   // allocation counts for all the samples
+   size_t alloc_sample = 0;
+   size_t byte_sample  = 0;
+   //
+   // sample_pass
+   // time for a pass that is a sample (the allocation counts do not include
+   // the memory used to store the samples)
+   auto sample_pass = [&](void)
+   {  //
+      // span, ctx_pass, fault_pass
+      // context switches and page faults are only counted when tracing
+      trace_event span("sample", "fun_speed");
+      double ctx_pass = 0.0, fault_pass = 0.0;
+      if( trace_event::enabled() )
+         rusage_count(ctx_pass, fault_pass);
       //
-      // computation
-      for(size_t i = 0; i < repeat; ++i)
-      {  uniform_01(x);
+      // t_pass, alloc_sample, byte_sample
+      size_t alloc_start = alloc_count::n_alloc();
+      size_t byte_start  = alloc_count::n_byte();
+      double t_pass      = time_pass(repeat);
+      alloc_sample      += alloc_count::n_alloc() - alloc_start;
+      byte_sample       += alloc_count::n_byte()  - byte_start;
+      //
+      // span
+      if( trace_event::enabled() )
+      {  double ctx_end, fault_end;
+         rusage_count(ctx_end, fault_end);
+         span.arg("repeat",     double(repeat) );
+         span.arg("ctx_switch", ctx_end - ctx_pass);
+         span.arg("page_fault", fault_end - fault_pass);
+      }
+      return sample_value(t_pass);
+   };
+   //
+   // speed.time_sample, i_sample, alloc_sample, byte_sample
+   size_t i_sample = 0;
+   if( n_warmup == 0 )
+   {  speed.time_sample[i_sample++] = sample_value(t_diff);
+      alloc_sample = alloc_pass;
+      byte_sample  = byte_pass;
+   }
+   //
+   // warm-up passes
+   for(size_t i = 1; i < n_warmup; ++i)
+   {  trace_event span("warmup", "fun_speed");
+      time_pass(repeat);
+      span.arg("repeat", double(repeat) );
+   }
+   if( 0 < n_warmup )
+      counter.reset();
+   //
+   // t_sample
+   uint64_t t_sample = clock.tick();
+   //
+   // speed.time_sample
+   while( i_sample < n_sample )
+      speed.time_sample[i_sample++] = sample_pass();
+   //
+   // speed.time_sample
+   // more samples until the relative error target or the time budget is met
+   if( 0.0 < speed_option.rel_error )
+   {  speed_stat(speed);
+      bool budget = true;
+      while( budget && ! ( speed.rel_error <= speed_option.rel_error ) )
+      {  //
+         // n_batch
+         size_t n_batch = std::max( speed.time_sample.size() / 4, size_t(1) );
+         for(size_t i_batch = 0; budget && i_batch < n_batch; ++i_batch)
+         {  double t_used = clock.seconds( clock.tick() - t_sample );
+            budget        = t_used < speed_option.max_time;
+            if( budget )
+               speed.time_sample.push_back( sample_pass() );
+         }
+         speed_stat(speed);
+      }
+   }
+   //
+   // speed.ctx_switch, speed.page_fault
+   rusage_count(speed.ctx_switch, speed.page_fault);
+   speed.ctx_switch -= ctx_start;
+   speed.page_fault -= fault_start;
+   //
+   // speed.n_sample, n_eval
+   // number of samples and computations that were timed
+   speed.n_sample = speed.time_sample.size();
+   double n_eval  = double(speed.n_sample) * double(repeat);
+   //
+   // speed.alloc_setup, speed.byte_setup, speed.alloc_eval, speed.byte_eval
+   // all of the samples were counted
+   if( alloc_count::enabled() )
+   {  speed.alloc_setup = alloc_setup;
+      speed.byte_setup  = byte_setup;
+      speed.alloc_eval  = double(alloc_sample) / n_eval;
+      speed.byte_eval   = double(byte_sample) / n_eval;
+   }
+   //
+   // speed.latency
+   // time each computation separately; the n_sample * repeat computations
+   // take about the same time as the samples
+   // (the overhead for reading the clock is subtracted)
+   if( speed_option.latency )
+   {  trace_event span("latency", "fun_speed");
+      double t_clock = clock.overhead();
+      size_t n_call  = speed.n_sample * repeat;
+      span.arg("n_call", double(n_call) );
+      for(size_t i = 0; i < n_call; ++i)
+      {  const cmpad::vector<double>& x = pool[i_pool];
+         if( ++i_pool == n_pool )
+            i_pool = 0;
+         if( flush )
+            flush_cache();
+         uint64_t t_start = clock.tick();
          if( option.time_setup )
             fun_obj.setup(option);
          fun_obj(x);
+         uint64_t t_end = clock.tick();
+         double seconds = clock.seconds(t_end - t_start) - t_clock;
+         speed.latency.record( uint64_t( std::max(seconds, 0.0) * 1e9 ) );
       }
-      // t_diff
-      t_end   = steady_clock::now();
-      t_diff  = duration(t_end - t_start).count();
    }
-   double rate = double(repeat) / t_diff;
-   return rate;
+   //
+   // speed.tape_stats
+   if constexpr( std::is_base_of<gradient, Fun_Obj>::value )
+      speed.tape_stats = fun_obj.stats();
+   //
+   // speed.cache_level
+   // smallest cache level that holds the tape and the work space
+   double n_byte = speed.tape_stats.tape_bytes;
+   if( ! std::isnan( speed.tape_stats.work_bytes ) )
+   {  if( std::isnan(n_byte) )
+         n_byte = speed.tape_stats.work_bytes;
+      else
+         n_byte += speed.tape_stats.work_bytes;
+   }
+   size_t level = cache_level(n_byte);
+   if( 0 < level )
+      speed.cache_level = double(level);
+   //
+   // speed.perf_count
+   // all of the samples were counted
+   if( speed_option.perf_counter )
+   {  speed.perf_count.resize( perf_counter::n_event );
+      for(size_t event = 0; event < perf_counter::n_event; ++event)
+         speed.perf_count[event] = counter.count(event) / n_eval;
+   }
+   //
+   // speed.n_profile, speed.profile
+   // extra passes, that are not timed, with the same number of computations
+   // as the samples (after the counter values above are used)
+   if( speed_option.profile && sample_profiler::start(1e-3) )
+   {  trace_event span("profile", "fun_speed");
+      for(size_t i = 0; i < speed.n_sample; ++i)
+         time_pass(repeat);
+      sample_profiler::stop();
+      speed.n_profile = sample_profiler::n_sample();
+      speed.profile   = sample_profiler::profile();
+   }
+   //
+   // speed.max_rss
+   speed.max_rss = alloc_count::max_rss();
+   //
+   // speed
+   speed_stat(speed);
+   //
+   return speed;
+}
+
+// BEGIN PROTOTYPE
+template <class Fun_Obj> double fun_speed(
+   Fun_Obj&         fun_obj    ,
+   const option_t&  option     ,
+   double           min_time   )
+// END PROTOTYPE
+{  speed_option_t speed_option;
+   speed_result_t speed = fun_speed(fun_obj, option, min_time, speed_option);
+   return speed.rate;
 }
 
 } // END cmpad namespace
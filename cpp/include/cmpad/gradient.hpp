@@ -7,6 +7,7 @@
 /*
 {xrst_begin cpp_gradient}
 {xrst_spell
+   nan
    typedef
 }
 
@@ -62,6 +63,8 @@ The object *grad* is initialized using its ``setup`` member function
 (which in turn initializes *algo* using its ``setup`` member function).
 The ``setup`` functions should do calculations that do not depend on *x*
 (to make the evaluation of the gradient faster).
+The phases of the setup, e.g. recording and optimizing,
+are tagged using :ref:`phase_timer-name` .
 
 vector_type
 ***********
@@ -107,6 +110,16 @@ This result is has equal to the dimension of the range space for the gradient,
 which is equal to the size of *x* .
 It is the gradient evaluated at the point *x* .
 
+stats
+*****
+This optional member function returns the :ref:`tape_stats_t-name`
+for the current tape; i.e., the tape used by the most recent
+gradient evaluation.
+The default implementation returns all ``nan`` values
+(the values are not available).
+The :ref:`cpp_fun_speed-name` routine calls this function
+after the timing is complete.
+
 Example and Derived Classes
 ***************************
 {xrst_comment BEGIN_SORT_THIS_LINE_PLUS_3}
@@ -130,6 +143,8 @@ Example and Derived Classes
 // BEGIN C++
 # include <cmpad/vector.hpp>
 # include <cmpad/fun_obj.hpp>
+# include <cmpad/phase_timer.hpp>
+# include <cmpad/tape_stats_t.hpp>
 
 namespace cmpad {
    // gradient
@@ -150,6 +165,9 @@ namespace cmpad {
       virtual const cmpad::vector<double>& operator()(
          const cmpad::vector<double>& x
       ) override = 0;
+      // stats
+      virtual tape_stats_t stats(void) const
+      {  return tape_stats_t(); }
    };
 
 }
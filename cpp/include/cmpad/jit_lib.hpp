@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_JIT_LIB_HPP
+# define CMPAD_JIT_LIB_HPP
+
+# include <cstddef>
+# include <string>
+# include <filesystem>
+namespace cmpad {
+   class jit_lib {
+   public:
+      static std::filesystem::path new_dir(const std::string& package);
+      static void   release_dir(const std::filesystem::path& dir);
+      static void   enable_perf_map(bool on);
+      static bool   perf_map_enabled(void);
+      static size_t perf_map(const std::filesystem::path& dir);
+   };
+}
+
+# endif
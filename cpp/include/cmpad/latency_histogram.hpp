@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_LATENCY_HISTOGRAM_HPP
+# define CMPAD_LATENCY_HISTOGRAM_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <cmath>
+# include <cassert>
+# include <algorithm>
+# include <limits>
+/*
+{xrst_begin latency_histogram}
+{xrst_spell
+   hdr
+   nan
+   ns
+   struct
+}
+
+A Log Bucketed Latency Histogram
+################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/latency_histogram.hpp>``
+| |tab| ``cmpad::latency_histogram`` *histogram*
+| |tab| *histogram* . ``record`` ( *ns* )
+| |tab| *n_call* = *histogram* . ``n_call`` ()
+| |tab| *seconds* = *histogram* . ``max`` ()
+| |tab| *seconds* = *histogram* . ``percentile`` ( *p* )
+| |tab| *n_bucket* = ``cmpad::latency_histogram::n_bucket``
+| |tab| *count* = *histogram* . ``count`` ( *index* )
+| |tab| *seconds* = *histogram* . ``lower`` ( *index* )
+| |tab| *seconds* = *histogram* . ``upper`` ( *index* )
+
+Purpose
+*******
+This histogram records the latency of individual calls in the style of
+an HDR histogram:
+the buckets are exact for small values and, for larger values,
+each power of two is divided into 32 buckets of equal width.
+Hence the relative error in a recorded value is at most 1/32.
+The buckets are a fixed size array, so recording a value does not
+allocate memory and takes a small constant time.
+
+ns
+**
+This ``uint64_t`` value is a latency in nanoseconds.
+The ``record`` routine adds one to the count for the bucket that contains
+*ns* .
+
+n_call
+******
+This ``size_t`` value is the number of latencies that have been recorded.
+
+max
+***
+This is the maximum recorded latency in seconds
+(it is exact, not rounded to a bucket).
+If *n_call* is zero, it is ``nan`` .
+
+percentile
+**********
+The ``double`` value *p* must be between zero and one hundred.
+The return value is the smallest bucket upper limit, in seconds,
+such that at least *p* percent of the recorded latencies are in or below
+the bucket.
+It is never greater than the maximum latency.
+If *n_call* is zero, it is ``nan`` .
+
+n_bucket
+********
+This ``static const size_t`` is the number of buckets in the histogram.
+
+index
+*****
+This ``size_t`` index is less than *n_bucket* and specifies a bucket.
+
+count
+=====
+is the number of recorded latencies that are in the bucket.
+
+lower
+=====
+is the lower limit for the bucket in seconds.
+A latency is in the bucket if it is greater than or equal to
+the lower limit and less than the upper limit.
+
+upper
+=====
+is the upper limit for the bucket in seconds.
+
+{xrst_toc_hidden
+   cpp/xam/latency_histogram.cpp
+}
+Example
+*******
+:ref:`xam_latency_histogram.cpp-name` contains an example and test of
+this class.
+
+{xrst_end latency_histogram}
+-------------------------------------------------------------------------------
+*/
+namespace cmpad {
+   class latency_histogram {
+   public:
+      // n_sub_bit, n_sub
+      // number of buckets per power of two is n_sub = 2^n_sub_bit
+      static const size_t n_sub_bit = 5;
+      static const size_t n_sub     = size_t(1) << n_sub_bit;
+      //
+      // n_bucket
+      // values less than n_sub are exact, then one row per power of two
+      static const size_t n_bucket  = (64 - n_sub_bit + 1) * n_sub;
+   private:
+      size_t   n_call_;
+      uint64_t max_;
+      uint64_t count_[n_bucket];
+      //
+      // index_of
+      static size_t index_of(uint64_t ns)
+      {  if( ns < n_sub )
+            return size_t(ns);
+         //
+         // msb: position of the most significant bit in ns
+         size_t msb = 63 - size_t( __builtin_clzll(ns) );
+         //
+         // shift: the sub-bucket is the top n_sub_bit + 1 bits of ns
+         size_t shift = msb - n_sub_bit;
+         size_t sub   = size_t(ns >> shift);
+         assert( n_sub <= sub && sub < 2 * n_sub );
+         return (shift + 1) * n_sub + (sub - n_sub);
+      }
+      //
+      // lower_ns
+      static double lower_ns(size_t index)
+      {  if( index < n_sub )
+            return double(index);
+         size_t shift = index / n_sub - 1;
+         size_t sub   = index % n_sub + n_sub;
+         return std::ldexp( double(sub), int(shift) );
+      }
+   public:
+      // constructor
+      latency_histogram(void)
+      {  n_call_ = 0;
+         max_    = 0;
+         for(size_t index = 0; index < n_bucket; ++index)
+            count_[index] = 0;
+      }
+      // record
+      void record(uint64_t ns)
+      {  ++count_[ index_of(ns) ];
+         ++n_call_;
+         if( max_ < ns )
+            max_ = ns;
+      }
+      // n_call
+      size_t n_call(void) const
+      {  return n_call_; }
+      //
+      // count
+      uint64_t count(size_t index) const
+      {  assert( index < n_bucket );
+         return count_[index];
+      }
+      // lower
+      double lower(size_t index) const
+      {  assert( index < n_bucket );
+         return lower_ns(index) * 1e-9;
+      }
+      // upper
+      double upper(size_t index) const
+      {  assert( index < n_bucket );
+         if( index + 1 == n_bucket )
+            return std::ldexp(1.0, 64) * 1e-9;
+         return lower_ns(index + 1) * 1e-9;
+      }
+      // max
+      double max(void) const
+      {  if( n_call_ == 0 )
+            return std::numeric_limits<double>::quiet_NaN();
+         return double(max_) * 1e-9;
+      }
+      // percentile
+      double percentile(double p) const
+      {  assert( 0.0 <= p && p <= 100.0 );
+         if( n_call_ == 0 )
+            return std::numeric_limits<double>::quiet_NaN();
+         //
+         // rank: number of calls that must be in or below the bucket
+         double rank = std::ceil( p * double(n_call_) / 100.0 );
+         if( rank < 1.0 )
+            rank = 1.0;
+         //
+         // index
+         size_t   index = 0;
+         uint64_t sum   = count_[0];
+         while( double(sum) < rank )
+            sum += count_[++index];
+         //
+         return std::min( upper(index), max() );
+      }
+   };
+}
+
+# endif
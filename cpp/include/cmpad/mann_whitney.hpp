@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_MANN_WHITNEY_HPP
+# define CMPAD_MANN_WHITNEY_HPP
+
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   // BEGIN MANN_WHITNEY_T
+   struct mann_whitney_t {
+      double u;
+      double p_value;
+      double speedup;
+      double speedup_lower;
+      double speedup_upper;
+   };
+   // END MANN_WHITNEY_T
+   mann_whitney_t mann_whitney(
+      const cmpad::vector<double>& baseline  ,
+      const cmpad::vector<double>& candidate ,
+      double                       alpha
+   );
+}
+
+# endif
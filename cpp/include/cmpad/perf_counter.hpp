@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_PERF_COUNTER_HPP
+# define CMPAD_PERF_COUNTER_HPP
+
+# include <cstddef>
+# include <cstdint>
+namespace cmpad {
+   class perf_counter {
+   public:
+      enum event_t {
+         cycles,
+         instructions,
+         l1d_miss,
+         llc_miss,
+         branch_miss,
+         dtlb_miss,
+         n_event
+      };
+      static const char* name(size_t event);
+      //
+      perf_counter(void);
+      perf_counter(const perf_counter& other) = delete;
+      perf_counter& operator=(const perf_counter& other) = delete;
+      ~perf_counter(void);
+      //
+      size_t open(void);
+      void   start(void);
+      void   stop(void);
+      void   reset(void);
+      double count(size_t event) const;
+   private:
+      int      fd_[n_event];
+      uint64_t value_[n_event];
+      uint64_t enabled_[n_event];
+      uint64_t running_[n_event];
+   };
+}
+
+# endif
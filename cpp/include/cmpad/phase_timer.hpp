@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_PHASE_TIMER_HPP
+# define CMPAD_PHASE_TIMER_HPP
+
+# include <string>
+# include <chrono>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   // BEGIN PHASE_T
+   struct phase_t {
+      std::string name;
+      double      seconds;
+   };
+   // END PHASE_T
+   class phase_timer {
+   private:
+      const char*                           name_;
+      bool                                  running_;
+      std::chrono::steady_clock::time_point start_;
+   public:
+      static void enable(bool on);
+      static bool enabled(void);
+      static void clear(void);
+      static const cmpad::vector<phase_t>& phase_vec(void);
+      //
+      phase_timer(const char* name);
+      phase_timer(const phase_timer& other) = delete;
+      phase_timer& operator=(const phase_timer& other) = delete;
+      ~phase_timer(void);
+      void stop(void);
+   };
+}
+
+# endif
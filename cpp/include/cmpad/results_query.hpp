@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_RESULTS_QUERY_HPP
+# define CMPAD_RESULTS_QUERY_HPP
+
+# include <cstddef>
+# include <string>
+# include <cmpad/vector.hpp>
+# include <cmpad/vec_vec_str.hpp>
+namespace cmpad {
+   // BEGIN QUERY_T
+   struct query_t {
+      cmpad::vector<std::string> where;
+      size_t                     days;
+      std::string                today;
+      cmpad::vector<std::string> group;
+      std::string                value;
+      std::string                stat;
+      std::string                pivot_row;
+      std::string                pivot_col;
+      std::string                base;
+      query_t(void)
+      : days(0), today(""), value("rate"), stat("median")
+      { }
+   };
+   // END QUERY_T
+   std::string results_query(
+      const std::string& source ,
+      const query_t&     query  ,
+      vec_vec_str&       table
+   );
+}
+
+# endif
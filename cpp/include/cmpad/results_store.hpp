@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_RESULTS_STORE_HPP
+# define CMPAD_RESULTS_STORE_HPP
+
+# include <cstddef>
+# include <cstdint>
+# include <map>
+# include <string>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   class results_store {
+   private:
+      // column_t
+      struct column_t {
+         bool                       numeric;
+         const void*                data;
+         size_t                     size;
+         bool                       dict_read;
+         cmpad::vector<std::string> dict;
+      };
+      std::string                       dir_;
+      bool                              ok_;
+      size_t                            n_row_;
+      cmpad::vector<std::string>        col_name_;
+      std::map<std::string, column_t>   column_;
+      //
+      column_t* load_(const std::string& name, bool numeric);
+   public:
+      static void               set_speed_dir(const std::string& dir);
+      static const std::string& speed_dir(void);
+      static bool               append(
+         const std::string&                dir       ,
+         const cmpad::vector<std::string>& col_name  ,
+         const cmpad::vector<std::string>& col_value
+      );
+      //
+      results_store(const std::string& dir);
+      results_store(const results_store& other) = delete;
+      results_store& operator=(const results_store& other) = delete;
+      ~results_store(void);
+      //
+      bool                              ok(void) const;
+      size_t                            n_row(void) const;
+      const cmpad::vector<std::string>& col_name(void) const;
+      bool                              numeric(const std::string& name) const;
+      //
+      const double*   f64(const std::string& name);
+      const uint32_t* code(const std::string& name);
+      const cmpad::vector<std::string>& dict(const std::string& name);
+      std::string     text(const std::string& name, size_t row);
+      cmpad::vector<size_t> rows(
+         const std::string& package   ,
+         const std::string& algorithm ,
+         size_t             n_arg
+      );
+   };
+}
+
+# endif
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SAMPLE_PROFILER_HPP
+# define CMPAD_SAMPLE_PROFILER_HPP
+
+# include <cstddef>
+# include <string>
+# include <ostream>
+# include <cmpad/vector.hpp>
+namespace cmpad {
+   // BEGIN PROFILE_T
+   struct profile_t {
+      std::string name;
+      size_t      flat;
+      size_t      cumulative;
+   };
+   // END PROFILE_T
+   class sample_profiler {
+   public:
+      static bool   start(double interval);
+      static void   stop(void);
+      static void   pause(bool paused);
+      static bool   running(void);
+      static size_t n_sample(void);
+      static size_t n_lost(void);
+      static cmpad::vector<profile_t> profile(void);
+      static void   print(
+         std::ostream&                   os        ,
+         const cmpad::vector<profile_t>& profile   ,
+         size_t                          n_sample  ,
+         size_t                          n_line
+      );
+   };
+}
+
+# endif
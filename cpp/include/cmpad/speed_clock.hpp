@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPEED_CLOCK_HPP
+# define CMPAD_SPEED_CLOCK_HPP
+
+# include <cstdint>
+# include <string>
+# include <chrono>
+# include <time.h>
+# include <cmpad/vector.hpp>
+
+// CMPAD_SPEED_CLOCK_TSC
+# if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+# define CMPAD_SPEED_CLOCK_TSC 1
+# elif defined(_M_X64)
+# include <intrin.h>
+# define CMPAD_SPEED_CLOCK_TSC 1
+# else
+# define CMPAD_SPEED_CLOCK_TSC 0
+# endif
+
+namespace cmpad {
+   class speed_clock {
+   public:
+      enum kind_t { steady_enum, tsc_enum, raw_enum };
+   private:
+      kind_t kind_;
+      double second_per_tick_;
+   public:
+      static bool available(const std::string& name);
+      //
+      speed_clock(const std::string& name);
+      const char* name(void) const;
+      double overhead(void) const;
+      double empty_pass(
+         const cmpad::vector< cmpad::vector<double> >& pool   ,
+         size_t&                                       i_pool ,
+         size_t                                        repeat ,
+         bool                                          flush
+      ) const;
+      //
+      // seconds
+      double seconds(uint64_t n_tick) const
+      {  return double(n_tick) * second_per_tick_; }
+      //
+      // tick
+      uint64_t tick(void) const
+      {  switch( kind_ )
+         {
+# if CMPAD_SPEED_CLOCK_TSC
+            // rdtscp waits for the previous instructions to complete
+            case tsc_enum:
+            {  unsigned int aux;
+               return uint64_t( __rdtscp(&aux) );
+            }
+# endif
+# ifdef CLOCK_MONOTONIC_RAW
+            case raw_enum:
+            {  struct timespec ts;
+               clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+               return uint64_t(ts.tv_sec) * 1000000000 + uint64_t(ts.tv_nsec);
+            }
+# endif
+            default:
+            break;
+         }
+         typedef std::chrono::nanoseconds nanoseconds;
+         return uint64_t( std::chrono::duration_cast<nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+         ).count() );
+      }
+   };
+}
+
+# endif
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPEED_OPTION_T_HPP
+# define CMPAD_SPEED_OPTION_T_HPP
+
+# include <cstddef>
+# include <string>
+/*
+{xrst_begin speed_option_t}
+{xrst_spell
+   struct
+}
+
+The Speed Option Type
+#####################
+
+Syntax
+******
+| |tab| ``# include <cmpad/speed_option_t.hpp>``
+
+Purpose
+*******
+This type controls how :ref:`cpp_fun_speed-name` measures the speed
+of a function object
+(while :ref:`option_t-name` controls the function object itself).
+The default values correspond to a single timing sample
+without any extra warm-up passes.
+
+Source Code
+***********
+{xrst_code cpp} */
+namespace cmpad {
+   struct speed_option_t {
+      size_t n_warmup;
+      size_t n_sample;
+      size_t n_pool;
+      bool   perf_counter;
+      bool   latency;
+      std::string clock;
+      double rel_error;
+      double max_time;
+      bool   flush_cache;
+      bool   profile;
+      speed_option_t(void)
+      {  n_warmup     = 0;
+         n_sample     = 1;
+         n_pool       = 16;
+         perf_counter = false;
+         latency      = false;
+         clock        = "steady";
+         rel_error    = 0.0;
+         max_time     = 10.0;
+         flush_cache  = false;
+         profile      = false;
+      }
+   };
+}
+/* {xrst_code}
+
+n_warmup
+********
+is the number of untimed passes, after the repeat count has been determined,
+that are made before the timing samples.
+Each pass computes the function object the same number of times as
+one timing sample.
+
+n_sample
+********
+is the number of independent timing samples; see
+:ref:`speed_result_t@time_sample` .
+It must be greater than zero.
+
+n_pool
+******
+is the number of argument vectors in the pool of inputs.
+The pool is filled with random values before any timing is done
+and the function object arguments cycle through the pool.
+Hence the time to generate the arguments is not included in the timing.
+A larger pool makes it harder for branch prediction and the caches
+to learn the arguments.
+It must be greater than zero.
+
+perf_counter
+************
+If this is true, the :ref:`perf_counter-name` hardware events are counted
+during the timing samples; see :ref:`speed_result_t@perf_count` .
+
+latency
+*******
+If this is true, an extra pass is made after the timing samples
+where each computation of the function object is timed separately;
+see :ref:`speed_result_t@latency` .
+
+clock
+*****
+is the :ref:`speed_clock@name` for the clock used to do the timing.
+
+rel_error
+*********
+If this is zero, exactly *n_sample* timing samples are taken.
+Otherwise, more samples are taken until the relative standard error
+of the samples is less than or equal *rel_error* ; e.g., 0.01 for one percent.
+See :ref:`cpp_fun_speed@speed_option@Convergence` .
+
+max_time
+********
+If *rel_error* is not zero, this is the time budget in seconds
+for the samples; i.e., no more samples are taken after this much time
+even if *rel_error* has not been achieved.
+It should be greater than zero.
+
+flush_cache
+***********
+If this is true, the caches are flushed before each computation of the
+function object (outside of the timing); see
+:ref:`cpp_fun_speed@speed_option@Cold Caches` .
+
+profile
+*******
+If this is true, the :ref:`sample_profiler-name` is run during extra
+passes after the timing samples; see :ref:`speed_result_t@profile` .
+
+{xrst_end speed_option_t}
+*/
+
+# endif
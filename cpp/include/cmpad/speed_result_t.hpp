@@ -0,0 +1,399 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPEED_RESULT_T_HPP
+# define CMPAD_SPEED_RESULT_T_HPP
+
+# include <cstddef>
+# include <string>
+# include <limits>
+# include <cmpad/vector.hpp>
+# include <cmpad/latency_histogram.hpp>
+# include <cmpad/phase_timer.hpp>
+# include <cmpad/tape_stats_t.hpp>
+# include <cmpad/bench_env.hpp>
+# include <cmpad/sample_profiler.hpp>
+/*
+{xrst_begin speed_result_t}
+{xrst_spell
+   ctx
+   gflops
+   mad
+   nan
+   rss
+   struct
+}
+
+The Speed Result Type
+#####################
+
+Syntax
+******
+| |tab| ``# include <cmpad/speed_result_t.hpp>``
+
+Purpose
+*******
+This type holds the results of a :ref:`cpp_fun_speed-name` measurement.
+These results are recorded in a csv file by :ref:`cpp_csv_speed-name` .
+
+nan
+***
+A floating point value that is ``nan`` has not been computed.
+It is recorded as an empty value in the csv file.
+
+Source Code
+***********
+{xrst_code cpp} */
+namespace cmpad {
+   struct speed_result_t {
+      double                rate;
+      size_t                n_warmup;
+      size_t                n_sample;
+      size_t                n_pool;
+      size_t                n_outlier;
+      double                time_median;
+      double                time_mad;
+      double                time_min;
+      double                time_lower;
+      double                time_upper;
+      double                rel_error;
+      double                time_init;
+      double                break_even;
+      double                alloc_setup;
+      double                byte_setup;
+      double                alloc_eval;
+      double                byte_eval;
+      double                max_rss;
+      std::string           clock;
+      bool                  flush_cache;
+      double                cache_level;
+      double                time_overhead;
+      size_t                n_raw;
+      std::string           ratio_base;
+      double                ratio_median;
+      double                ratio_lower;
+      double                ratio_upper;
+      double                ctx_switch;
+      double                page_fault;
+      double                static_ratio;
+      double                grad_ratio;
+      double                n_flop;
+      double                gflops;
+      double                efficiency;
+      bench_env_t           env;
+      cmpad::vector<phase_t> setup_phase;
+      tape_stats_t          tape_stats;
+      cmpad::vector<double> time_sample;
+      cmpad::vector<double> perf_count;
+      latency_histogram     latency;
+      size_t                n_profile;
+      cmpad::vector<profile_t> profile;
+      speed_result_t(void)
+      {  double nan = std::numeric_limits<double>::quiet_NaN();
+         rate        = nan;
+         n_warmup    = 0;
+         n_sample    = 0;
+         n_pool      = 0;
+         n_outlier   = 0;
+         time_median = nan;
+         time_mad    = nan;
+         time_min    = nan;
+         time_lower  = nan;
+         time_upper  = nan;
+         rel_error   = nan;
+         time_init   = nan;
+         break_even  = nan;
+         alloc_setup = nan;
+         byte_setup  = nan;
+         alloc_eval  = nan;
+         byte_eval   = nan;
+         max_rss     = nan;
+         flush_cache   = false;
+         cache_level   = nan;
+         time_overhead = nan;
+         n_raw         = 0;
+         ratio_median  = nan;
+         ratio_lower   = nan;
+         ratio_upper   = nan;
+         ctx_switch    = nan;
+         page_fault    = nan;
+         static_ratio  = nan;
+         grad_ratio    = nan;
+         n_flop        = nan;
+         gflops        = nan;
+         efficiency    = nan;
+         n_profile     = 0;
+      }
+   };
+}
+/* {xrst_code}
+
+rate
+****
+is the number of times per second that the function object is computed;
+i.e., one over *time_median* .
+
+n_warmup
+********
+is the number of warm-up passes; see :ref:`speed_option_t@n_warmup` .
+
+n_sample
+********
+is the number of timing samples; see :ref:`speed_option_t@n_sample`
+and :ref:`speed_option_t@rel_error` .
+This includes the samples that were rejected as outliers.
+
+n_pool
+******
+is the number of argument vectors in the pool of inputs;
+see :ref:`speed_option_t@n_pool` .
+
+n_outlier
+*********
+is the number of timing samples that were rejected as outliers.
+
+time_median
+***********
+is the median, of the samples that were not rejected,
+of the seconds for one computation of the function object.
+
+time_mad
+********
+is the median absolute deviation of the samples
+that were not rejected.
+
+time_min
+********
+is the minimum of the samples that were not rejected.
+
+time_lower
+**********
+is the lower limit of a 95 percent confidence interval for *time_median* .
+
+time_upper
+**********
+is the upper limit of a 95 percent confidence interval for *time_median* .
+
+rel_error
+*********
+is the relative standard error of the samples that were not rejected;
+i.e., the sample standard deviation divided by the square root of the
+number of samples and by the sample mean.
+It is ``nan`` if there are less than two such samples.
+It is also an estimate of the relative standard error in *rate* .
+
+time_init
+*********
+is the seconds for the first call to the function object setup routine;
+i.e., the setup that is done before any of the timing passes.
+This is separate from the samples even when
+:ref:`option_t@time_setup` is false.
+
+setup_phase
+***********
+is the :ref:`phase_timer@phase_vec` for the first call to the
+function object setup routine; i.e., the time for each of the phases
+that is included in *time_init* .
+It is empty if the setup routine does not tag any phases.
+
+tape_stats
+**********
+If the function object is a :ref:`cpp_gradient-name` object,
+this is the :ref:`tape_stats_t-name` returned by its
+:ref:`cpp_gradient@stats` function after the timing is complete.
+Otherwise all of its values are ``nan`` .
+
+break_even
+**********
+is the number of computations after which this function object is faster
+than a base function object; see :ref:`break_even-name` .
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+
+alloc_setup
+***********
+If :ref:`alloc_count@on` is true,
+this is the number of heap allocations during the first call to the
+function object setup routine.
+Otherwise it is ``nan`` .
+
+byte_setup
+**********
+If :ref:`alloc_count@on` is true,
+this is the number of bytes requested by the heap allocations
+during the first call to the function object setup routine.
+Otherwise it is ``nan`` .
+
+alloc_eval
+**********
+If :ref:`alloc_count@on` is true,
+this is the number of heap allocations during one computation
+of the function object (averaged over the timing samples).
+Otherwise it is ``nan`` .
+If :ref:`option_t@time_setup` is true,
+this includes the allocations during setup.
+
+byte_eval
+*********
+If :ref:`alloc_count@on` is true,
+this is the number of bytes requested by the heap allocations
+during one computation of the function object
+(averaged over the timing samples).
+Otherwise it is ``nan`` .
+
+max_rss
+*******
+is the peak resident set size, in bytes, for the program when
+:ref:`cpp_fun_speed-name` returns; see :ref:`alloc_count@max_rss` .
+
+clock
+*****
+is the :ref:`speed_clock@name` for the clock that was used for the timing.
+It is empty if :ref:`cpp_fun_speed-name` did not set it.
+
+flush_cache
+***********
+is true if the caches were flushed before each computation;
+see :ref:`speed_option_t@flush_cache` .
+
+cache_level
+***********
+is the :ref:`cache_info@level` that holds the
+*tape_bytes* plus *work_bytes* in :ref:`speed_result_t@tape_stats` .
+It is ``nan`` if both of these are ``nan`` ,
+or if the cache sizes are not available.
+
+time_overhead
+*************
+is the overhead, in seconds per computation, for reading the clock and
+for the loop that computes the function object.
+It has been subtracted from each of the timing samples;
+see :ref:`cpp_fun_speed@speed_option@Overhead` .
+
+n_raw
+*****
+is the number of timing samples that *time_overhead* was not subtracted from
+because the time for the pass was not greater than the overhead.
+These samples are upper bounds for the time of a computation.
+
+ratio_base
+**********
+If this is not empty, it identifies a base function object
+that this function object was compared with; see :ref:`fun_compare-name` .
+The :ref:`cpp_fun_speed-name` and :ref:`fun_compare-name`
+routines do not set this value.
+
+ratio_median
+************
+is the median of the paired samples of the ratio of the time for
+this function object divided by the time for the base function object;
+see :ref:`fun_compare@speed@Ratio` .
+It is ``nan`` if this function object was not compared with a base.
+
+ratio_lower
+***********
+is the lower limit of a 95 percent confidence interval for *ratio_median* .
+
+ratio_upper
+***********
+is the upper limit of a 95 percent confidence interval for *ratio_median* .
+
+ctx_switch
+**********
+is the number of context switches, for the thread that did the timing,
+from the start of the timing passes to the end of the samples;
+see :ref:`bench_env@ctx_switch` .
+A non-zero value means that some of the samples may have been
+interrupted by other programs.
+
+page_fault
+**********
+is the number of page faults, for the thread that did the timing,
+from the start of the timing passes to the end of the samples;
+see :ref:`bench_env@page_fault` .
+
+static_ratio
+************
+is the rate for the :ref:`static_fun-name` version of this function object
+divided by *rate* ; i.e., the speed up obtained by calling the
+function object directly instead of through the virtual function table.
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+It is set by the C++ version of run_cmpad for the
+``none`` :ref:`csv_column@package`.
+
+grad_ratio
+**********
+is the *rate* for the algorithm, without any derivatives,
+divided by *rate* for this gradient function object;
+i.e., the cost of a gradient relative to the cost of the function.
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+It is set by the C++ version of run_cmpad for the packages
+other than ``none`` .
+
+n_flop
+******
+is the number of floating point operations for one computation of the
+algorithm (without any derivatives); see :ref:`count_scalar@op_count` .
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+It is set by the C++ version of run_cmpad.
+
+gflops
+******
+is *n_flop* times *rate* divided by :math:`10^9` ; i.e.,
+the billions of algorithm floating point operations per second.
+For a gradient function object, this counts the operations for the
+algorithm, not the operations done by the AD package, so it is the
+function throughput that is equivalent to the gradient computation.
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+
+efficiency
+**********
+is *gflops* divided by the peak floating point operations per second
+for the machine; see :ref:`run_cmpad@peak_gflops` .
+The :ref:`cpp_fun_speed-name` routine does not set this value.
+
+env
+***
+is the :ref:`bench_env@env` for the timing.
+The :ref:`cpp_fun_speed-name` routine does not set this value;
+i.e., it has the default value for a ``bench_env_t`` object.
+
+time_sample
+***********
+is the vector of timing samples, in the order they were taken.
+Each sample is the seconds for one computation of the function object.
+
+perf_count
+**********
+If :ref:`speed_option_t@perf_counter` is false, this vector is empty.
+Otherwise it has size ``cmpad::perf_counter::n_event`` and
+*perf_count* [ *event* ] is the number of times the
+:ref:`perf_counter@event` occurred during one computation of the
+function object (averaged over the timing samples).
+It is ``nan`` if the event could not be counted.
+
+latency
+*******
+If :ref:`speed_option_t@latency` is false,
+this :ref:`latency_histogram-name` is empty; i.e., its *n_call* is zero.
+Otherwise it contains the seconds for each of the computations
+of the function object during the latency pass.
+
+n_profile
+*********
+If :ref:`speed_option_t@profile` is false, this is zero.
+Otherwise it is the number of call stacks recorded by the
+:ref:`sample_profiler-name` during the profile passes;
+see :ref:`cpp_fun_speed@speed_option@Profile` .
+
+profile
+*******
+If :ref:`speed_option_t@profile` is false, this vector is empty.
+Otherwise it is the :ref:`sample_profiler@profile` for the
+profile passes.
+It is empty if the profiler could not be started.
+
+{xrst_end speed_result_t}
+*/
+
+# endif
@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_SPEED_STAT_HPP
+# define CMPAD_SPEED_STAT_HPP
+
+# include <cmpad/speed_result_t.hpp>
+namespace cmpad {
+   void speed_stat(speed_result_t& speed);
+}
+
+# endif
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_STATIC_FUN_HPP
+# define CMPAD_STATIC_FUN_HPP
+/*
+{xrst_begin static_fun}
+{xrst_spell
+   obj
+}
+
+Function Objects With Static Dispatch
+#####################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/static_fun.hpp>``
+| |tab| ``cmpad::static_fun`` < *Fun_Obj* > *fun_obj*
+
+Purpose
+*******
+The :ref:`cpp_fun_obj-name` member functions are virtual.
+For small problems, the indirect function calls,
+and the inlining that they prevent, can be a significant part of the
+time for a computation.
+A ``static_fun`` < *Fun_Obj* > object is a *Fun_Obj* object
+in a class that is ``final`` .
+Hence, when a routine uses the ``static_fun`` type
+(e.g., :ref:`cpp_fun_speed-name` is a template on the function object type),
+the compiler knows which member function is called
+and can call it directly, or inline it,
+instead of using the virtual function table.
+
+Fun_Obj
+*******
+This is a non-abstract class that is derived from :ref:`cpp_fun_obj-name` ;
+e.g., ``cmpad::det_by_minor< cmpad::vector<double> >`` .
+It must not be ``final`` .
+
+fun_obj
+*******
+This object has all the constructors and public members of
+a *Fun_Obj* object.
+
+{xrst_toc_hidden
+   cpp/xam/static_fun.cpp
+}
+Example
+*******
+:ref:`xam_static_fun.cpp-name` contains an example and test of this class.
+
+{xrst_end static_fun}
+-------------------------------------------------------------------------------
+*/
+namespace cmpad {
+   template <class Fun_Obj> class static_fun final : public Fun_Obj {
+   public:
+      using Fun_Obj::Fun_Obj;
+   };
+}
+
+# endif
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_TAPE_STATS_T_HPP
+# define CMPAD_TAPE_STATS_T_HPP
+
+# include <limits>
+/*
+{xrst_begin tape_stats_t}
+{xrst_spell
+   adjoints
+   nan
+   struct
+   taylor
+}
+
+The Tape Statistics Type
+########################
+
+Syntax
+******
+| |tab| ``# include <cmpad/tape_stats_t.hpp>``
+
+Purpose
+*******
+This type holds the size of the tape, and of the work space,
+that a package uses to compute a gradient; see
+:ref:`cpp_gradient@stats` .
+Each package computes these values using its own statistics routines,
+so the meaning of an operation and a variable is package specific.
+
+nan
+***
+A value that is ``nan`` is not available for the package.
+It is recorded as an empty value in the csv file.
+The default constructor sets all the values to ``nan`` .
+
+Source Code
+***********
+{xrst_code cpp} */
+namespace cmpad {
+   struct tape_stats_t {
+      double n_op;
+      double n_var;
+      double tape_bytes;
+      double work_bytes;
+      tape_stats_t(void)
+      {  double nan = std::numeric_limits<double>::quiet_NaN();
+         n_op       = nan;
+         n_var      = nan;
+         tape_bytes = nan;
+         work_bytes = nan;
+      }
+   };
+}
+/* {xrst_code}
+
+n_op
+****
+is the number of operations in the tape.
+
+n_var
+*****
+is the number of variables in the tape.
+
+tape_bytes
+**********
+is the number of bytes used to store the tape.
+
+work_bytes
+**********
+is the number of bytes of work space used to evaluate the tape;
+e.g., to store the values of the variables and their derivatives.
+
+Packages
+********
+The table below lists the package routines that are used to compute
+the statistics. Packages that are not in the table use the default
+:ref:`cpp_gradient@stats` ; i.e., all the values are ``nan`` .
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   package, n_op, n_var, tape_bytes, work_bytes
+   adept, ``n_statements``, ``max_gradients``, ``memory``, *n_var* adjoints
+   adolc, ``NUM_OPERATIONS``, ``NUM_MAX_LIVES``, operations locations values, ``TAY_STACK_SIZE``
+   codi, ``StatementSize``, ``LargestIdentifier``, ``getUsedMemorySize``,
+   cppad, ``size_op``, ``size_var``, ``size_op_seq``, Taylor coefficients
+   cppad_jit, ``size_op``, ``size_var``, ``size_op_seq``,
+   cppadcg, ``size_op``, ``size_var``, ``size_op_seq``,
+
+#. The adolc columns are the corresponding ``tapestats`` values.
+   Its *tape_bytes* is the sum of the bytes for the operations, locations
+   and values in the tape.
+#. The codi statistics are only available when *time_setup* is false
+   (when it is true, the tape is cleared after each gradient evaluation).
+#. The cppad_jit statistics are for the gradient tape that is compiled.
+   The cppadcg statistics are for the function tape that the source
+   code is generated from.
+
+{xrst_end tape_stats_t}
+*/
+
+# endif
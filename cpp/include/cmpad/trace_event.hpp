@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+# ifndef CMPAD_TRACE_EVENT_HPP
+# define CMPAD_TRACE_EVENT_HPP
+
+# include <cstddef>
+# include <string>
+# include <chrono>
+namespace cmpad {
+   class trace_event {
+   public:
+      typedef std::chrono::steady_clock::time_point time_point;
+   private:
+      const char* name_;
+      const char* cat_;
+      bool        running_;
+      time_point  start_;
+      std::string arg_;
+   public:
+      static void   enable(bool on);
+      static bool   enabled(void);
+      static void   clear(void);
+      static size_t n_event(void);
+      static void   complete(
+         const char*        name     ,
+         const char*        cat      ,
+         time_point         start    ,
+         time_point         end      ,
+         const std::string& arg = ""
+      );
+      static bool   write(const std::string& file_name);
+      //
+      trace_event(const char* name, const char* cat);
+      trace_event(const trace_event& other) = delete;
+      trace_event& operator=(const trace_event& other) = delete;
+      ~trace_event(void);
+      void arg(const char* key, double value);
+      void stop(void);
+   };
+}
+
+# endif
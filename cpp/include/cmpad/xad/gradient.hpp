@@ -12,7 +12,7 @@
    @Package@       , XAD
    @#######@       , ###
    @package@       , xad
-   @not_cppad_jit@ , true
+   @not_jit@       , true
    @not_codi@      , true
 }
 
@@ -76,7 +76,9 @@ public:
       option_ = option;
       //
       // algo_
+      cmpad::phase_timer algo_phase("algo");
       algo_.setup(option);
+      algo_phase.stop();
       //
       // n
       size_t n = algo_.domain();
@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin alloc_count}
+{xrst_spell
+   getrusage
+   nan
+   rss
+}
+
+Count Heap Allocations
+######################
+
+Syntax
+******
+| |tab| ``# include <cmpad/alloc_count.hpp>``
+| |tab| *on* = ``cmpad::alloc_count::enabled`` ()
+| |tab| *n_alloc* = ``cmpad::alloc_count::n_alloc`` ()
+| |tab| *n_byte* = ``cmpad::alloc_count::n_byte`` ()
+| |tab| *max_rss* = ``cmpad::alloc_count::max_rss`` ()
+
+Purpose
+*******
+Some AD packages allocate memory during every derivative evaluation
+while others only allocate memory during setup.
+These routines make it possible to count the heap allocations
+during a computation; e.g., by taking the difference of the counts
+before and after the computation.
+
+on
+**
+This ``bool`` is true if
+:ref:`configure@CMPAD_ALLOC_COUNT` is one; i.e., if cmpad was configured with
+``-D cmpad_alloc_count=YES`` .
+In this case the cmpad library replaces the global
+``operator new`` and ``operator delete`` so that every call to
+``operator new`` , by any part of the program, is counted.
+The counters are atomic, so they are thread safe,
+but they add a small amount of time to each allocation.
+
+n_alloc
+*******
+This ``size_t`` value is the number of calls to ``operator new``
+since the program started.
+If *on* is false, it is always zero.
+
+n_byte
+******
+This ``size_t`` value is the total number of bytes requested by the
+calls to ``operator new`` since the program started
+(memory that has been freed is not subtracted).
+If *on* is false, it is always zero.
+
+max_rss
+*******
+This ``double`` value is the peak resident set size for the program,
+in bytes, as reported by ``getrusage`` .
+It does not depend on *on* and it is ``nan`` if
+``getrusage`` is not available.
+Note that it is the peak since the program started,
+so it can only increase from one computation to the next.
+
+{xrst_toc_hidden
+   cpp/xam/alloc_count.cpp
+}
+Example
+*******
+:ref:`xam_alloc_count.cpp-name` contains an example and test of this class.
+
+{xrst_end alloc_count}
+------------------------------------------------------------------------------
+*/
+# include <atomic>
+# include <limits>
+# include <cmpad/configure.hpp>
+# include <cmpad/alloc_count.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <sys/resource.h>
+# endif
+
+# if CMPAD_ALLOC_COUNT
+# include <new>
+# include <cstdlib>
+# endif
+
+namespace {
+   // n_alloc_, n_byte_
+   // constant initialization, so these are valid before any operator new
+   std::atomic<size_t> n_alloc_(0);
+   std::atomic<size_t> n_byte_(0);
+}
+
+# if CMPAD_ALLOC_COUNT
+namespace {
+   // allocate
+   void* allocate(std::size_t size, std::size_t align)
+   {  //
+      // n_alloc_, n_byte_
+      n_alloc_.fetch_add(1, std::memory_order_relaxed);
+      n_byte_.fetch_add(size, std::memory_order_relaxed);
+      //
+      // size
+      // malloc(0) may return a null pointer
+      if( size == 0 )
+         size = 1;
+      //
+      // ptr
+      while( true )
+      {  void* ptr;
+         if( align <= alignof(std::max_align_t) )
+            ptr = std::malloc(size);
+         else
+         {  // aligned_alloc requires size to be a multiple of align
+            std::size_t aligned_size = ( (size + align - 1) / align ) * align;
+            ptr = std::aligned_alloc(align, aligned_size);
+         }
+         if( ptr != nullptr )
+            return ptr;
+         std::new_handler handler = std::get_new_handler();
+         if( handler == nullptr )
+            throw std::bad_alloc();
+         handler();
+      }
+   }
+}
+//
+// The other forms of operator new and delete (array, nothrow, sized)
+// call these forms by default.
+void* operator new(std::size_t size)
+{  return allocate(size, 0); }
+void* operator new(std::size_t size, std::align_val_t align)
+{  return allocate( size, std::size_t(align) ); }
+void operator delete(void* ptr) noexcept
+{  std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept
+{  std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept
+{  std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{  std::free(ptr); }
+# endif
+
+namespace cmpad {
+   // enabled
+   bool alloc_count::enabled(void)
+   {  return CMPAD_ALLOC_COUNT != 0; }
+   //
+   // n_alloc
+   size_t alloc_count::n_alloc(void)
+   {  return n_alloc_.load(std::memory_order_relaxed); }
+   //
+   // n_byte
+   size_t alloc_count::n_byte(void)
+   {  return n_byte_.load(std::memory_order_relaxed); }
+   //
+   // max_rss
+   double alloc_count::max_rss(void)
+   {
+# if defined(__unix__) || defined(__APPLE__)
+      struct rusage usage;
+      if( getrusage(RUSAGE_SELF, &usage) != 0 )
+         return std::numeric_limits<double>::quiet_NaN();
+# ifdef __APPLE__
+      // bytes
+      return double( usage.ru_maxrss );
+# else
+      // kilobytes
+      return double( usage.ru_maxrss ) * 1024.0;
+# endif
+# else
+      return std::numeric_limits<double>::quiet_NaN();
+# endif
+   }
+}
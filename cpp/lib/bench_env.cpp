@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin bench_env}
+{xrst_spell
+   avg
+   cpufreq
+   ctx
+   getloadavg
+   getrusage
+   nan
+   pstate
+   sched
+   setaffinity
+   sys
+}
+
+Benchmark Environment
+#####################
+
+Syntax
+******
+| |tab| ``# include <cmpad/bench_env.hpp>``
+| |tab| *ok* = ``cmpad::pin_cpu`` ( *cpu* )
+| |tab| *env* = ``cmpad::bench_env`` ( *cpu* )
+| |tab| *warning* = ``cmpad::bench_warning`` ( *env* )
+| |tab| ``cmpad::rusage_count`` ( *ctx_switch* , *page_fault* )
+
+Purpose
+*******
+The timing of a computation is polluted by other programs,
+by changes in the processor frequency, and by moving the program
+from one core to another.
+These routines pin the program to a core, detect noisy conditions,
+and count the events that indicate a sample has been polluted.
+They use Linux specific system files and calls; on other systems
+the corresponding values are not available.
+
+cpu
+***
+This ``int`` is the index of a core; e.g., zero for the first core.
+A negative value means that the program is not pinned to a core.
+
+pin_cpu
+*******
+This routine uses ``sched_setaffinity`` to restrict the current thread
+to the core with index *cpu* .
+The return value *ok* is true if this succeeded.
+
+env
+***
+This ``cmpad::bench_env_t`` object is defined by
+{xrst_literal
+   cpp/include/cmpad/bench_env.hpp
+   // BEGIN BENCH_ENV_T
+   // END BENCH_ENV_T
+}
+
+cpu
+===
+is the value of *cpu* in the call to ``bench_env`` .
+
+governor
+========
+is the contents of the file
+
+| |tab| ``/sys/devices/system/cpu/cpu``\ *index*\ ``/cpufreq/scaling_governor``
+
+If *cpu* is non-negative, *index* is *cpu* .
+Otherwise, all the cores are checked and if they do not have the same
+governor, the value is ``mixed`` .
+It is empty if the governor is not available.
+
+turbo
+=====
+is ``on`` or ``off`` depending on whether the processor can increase
+its frequency above the base frequency.
+It is determined using
+
+| |tab| ``/sys/devices/system/cpu/intel_pstate/no_turbo``
+| |tab| ``/sys/devices/system/cpu/cpufreq/boost``
+
+It is empty if neither of these files exist.
+
+load_avg
+========
+is the one minute load average returned by ``getloadavg`` ;
+i.e., the average number of processes that are ready to run.
+It is ``nan`` if it is not available.
+
+warning
+*******
+This ``std::string`` is empty if no noisy conditions are detected.
+Otherwise it is a message, that ends with a newline,
+describing the noisy conditions; i.e.,
+*governor* is not empty and not ``performance`` ,
+*turbo* is ``on`` , or
+*load_avg* minus one is greater than or equal one half.
+The one is subtracted because the load average includes the
+benchmark process itself; e.g., during a sequence of back to back
+runs of run_cmpad, the load average is about one from cmpad alone.
+
+ctx_switch
+**********
+This ``double`` is set to the number of voluntary plus involuntary
+context switches for the current thread since it started.
+It is ``nan`` if it is not available.
+
+page_fault
+**********
+This ``double`` is set to the number of minor plus major page faults
+for the current thread since it started.
+It is ``nan`` if it is not available.
+
+{xrst_toc_hidden
+   cpp/xam/bench_env.cpp
+}
+Example
+*******
+:ref:`xam_bench_env.cpp-name` contains an example and test of these routines.
+
+{xrst_end bench_env}
+------------------------------------------------------------------------------
+*/
+# include <fstream>
+# include <sstream>
+# include <cmpad/bench_env.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <stdlib.h>
+# include <sys/resource.h>
+# endif
+
+# ifdef __linux__
+# include <sched.h>
+# endif
+
+namespace {
+   // read_line
+   // first line of a file (empty if the file cannot be read)
+   std::string read_line(const std::string& file_name)
+   {  std::ifstream file(file_name);
+      std::string   line;
+      if( file.good() )
+         std::getline(file, line);
+      return line;
+   }
+   //
+   // governor_file
+   std::string governor_file(int cpu)
+   {  return "/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+         "/cpufreq/scaling_governor";
+   }
+}
+
+namespace cmpad {
+   // pin_cpu
+   bool pin_cpu(int cpu)
+   {
+# ifdef __linux__
+      if( cpu < 0 || CPU_SETSIZE <= cpu )
+         return false;
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      CPU_SET(cpu, &cpu_set);
+      return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+# else
+      return false;
+# endif
+   }
+   //
+   // bench_env
+   bench_env_t bench_env(int cpu)
+   {  bench_env_t env;
+      env.cpu = cpu;
+      //
+      // env.governor
+      if( 0 <= cpu )
+         env.governor = read_line( governor_file(cpu) );
+      else
+      {  for(int index = 0; index < 4096; ++index)
+         {  std::string governor = read_line( governor_file(index) );
+            if( governor == "" )
+               break;
+            if( index == 0 )
+               env.governor = governor;
+            else if( governor != env.governor )
+               env.governor = "mixed";
+         }
+      }
+      //
+      // env.turbo
+      std::string no_turbo =
+         read_line("/sys/devices/system/cpu/intel_pstate/no_turbo");
+      std::string boost =
+         read_line("/sys/devices/system/cpu/cpufreq/boost");
+      if( no_turbo != "" )
+         env.turbo = no_turbo == "0" ? "on" : "off";
+      else if( boost != "" )
+         env.turbo = boost == "0" ? "off" : "on";
+      //
+      // env.load_avg
+# if defined(__unix__) || defined(__APPLE__)
+      double load_avg[1];
+      if( getloadavg(load_avg, 1) == 1 )
+         env.load_avg = load_avg[0];
+# endif
+      return env;
+   }
+   //
+   // bench_warning
+   std::string bench_warning(const bench_env_t& env)
+   {  std::stringstream ss;
+      if( env.governor != "" && env.governor != "performance" )
+         ss << "scaling_governor is " << env.governor
+            << " (instead of performance)\n";
+      if( env.turbo == "on" )
+         ss << "turbo boost is on\n";
+      //
+      // load average
+      // the benchmark process contributes about one to the load average
+      if( 0.5 <= env.load_avg - 1.0 )
+         ss << "load average is " << env.load_avg << "\n";
+      return ss.str();
+   }
+   //
+   // rusage_count
+   void rusage_count(double& ctx_switch, double& page_fault)
+   {  ctx_switch = std::numeric_limits<double>::quiet_NaN();
+      page_fault = std::numeric_limits<double>::quiet_NaN();
+# if defined(__unix__) || defined(__APPLE__)
+      struct rusage usage;
+# ifdef RUSAGE_THREAD
+      int who = RUSAGE_THREAD;
+# else
+      int who = RUSAGE_SELF;
+# endif
+      if( getrusage(who, &usage) == 0 )
+      {  ctx_switch = double( usage.ru_nvcsw ) + double( usage.ru_nivcsw );
+         page_fault = double( usage.ru_minflt ) + double( usage.ru_majflt );
+      }
+# endif
+   }
+}
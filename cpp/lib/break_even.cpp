@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin break_even}
+{xrst_spell
+   inf
+   nan
+}
+
+Number of Computations Where One Function Object Beats Another
+##############################################################
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+Some function objects, e.g. the ones that compile code,
+have a large setup cost and a small cost per computation.
+This routine computes how many computations are necessary before
+such a function object is faster than another one.
+
+speed
+*****
+This :ref:`speed_result_t-name` object is the result for the
+function object that we are checking.
+
+base
+****
+This :ref:`speed_result_t-name` object is the result for the
+function object that we are comparing against.
+
+Total Time
+**********
+The total time for *n* computations using *speed* is
+{xrst_code cpp}
+   speed.time_init + n * speed.time_median
+{xrst_code}
+and similarly for *base* .
+This assumes that :ref:`option_t@time_setup` was false when the
+results were computed.
+
+n_star
+******
+The return value *n_star* is the smallest *n* such that the
+total time for *speed* is less than or equal the total time for *base*
+for all computation counts greater than or equal *n* .
+
+#. If *speed* has a smaller *time_median* than *base* ,
+   *n_star* is the maximum of zero and the difference in *time_init*
+   divided by the difference in *time_median* .
+#. If *speed* has the same *time_median* as *base* ,
+   *n_star* is zero or ``inf`` depending on which *time_init* is smaller.
+#. If *speed* has a larger *time_median* than *base* ,
+   *n_star* is ``inf`` .
+#. If any of the values above is ``nan`` , *n_star* is ``nan`` .
+
+{xrst_toc_hidden
+   cpp/xam/break_even.cpp
+}
+Example
+*******
+:ref:`xam_break_even.cpp-name` contains an example and test of this routine.
+
+{xrst_end break_even}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <limits>
+# include <algorithm>
+# include <cmpad/break_even.hpp>
+
+namespace cmpad {
+   // BEGIN PROTOTYPE
+   double break_even(const speed_result_t& speed, const speed_result_t& base)
+   // END PROTOTYPE
+   {  //
+      // nan, inf
+      double nan = std::numeric_limits<double>::quiet_NaN();
+      double inf = std::numeric_limits<double>::infinity();
+      //
+      // init_diff, eval_diff
+      double init_diff = speed.time_init   - base.time_init;
+      double eval_diff = base.time_median  - speed.time_median;
+      if( std::isnan(init_diff) || std::isnan(eval_diff) )
+         return nan;
+      //
+      // n_star
+      if( eval_diff < 0.0 )
+         return inf;
+      if( eval_diff == 0.0 )
+      {  if( init_diff <= 0.0 )
+            return 0.0;
+         return inf;
+      }
+      return std::max(0.0, init_diff / eval_diff);
+   }
+}
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin cache_info}
+{xrst_spell
+   sys
+}
+
+Cache Sizes and Cache Flushing
+##############################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cache_info.hpp>``
+| |tab| *size* = ``cmpad::cache_size`` ()
+| |tab| *level* = ``cmpad::cache_level`` ( *n_byte* )
+| |tab| ``cmpad::flush_cache`` ()
+
+Purpose
+*******
+The speed of a derivative computation depends on whether its tape and
+work space fit in the processor caches.
+These routines determine the cache sizes and evict the data
+in the caches.
+The cache sizes are read from the Linux system files
+``/sys/devices/system/cpu/cpu0/cache/index``\ *i* for *i* = 0, 1, ... ;
+on other systems they are not available.
+
+size
+****
+This ``const cmpad::vector<size_t>&`` is the size in bytes of the
+data (or unified) cache for each level;
+i.e., *size* [ *level* - 1 ] is the size of the cache for *level* .
+Instruction caches are not included.
+It is empty if the cache sizes are not available.
+The files are only read the first time ``cache_size`` is called.
+
+n_byte
+******
+This ``double`` is the number of bytes that are used by a computation;
+e.g., the sum of the
+:ref:`tape_stats_t@tape_bytes` and :ref:`tape_stats_t@work_bytes` .
+
+level
+*****
+This ``size_t`` is the smallest cache level that can hold *n_byte* bytes.
+If *n_byte* is larger than all of the caches,
+it is one more than the number of levels; i.e., main memory.
+If *n_byte* is ``nan`` , or the cache sizes are not available,
+*level* is zero.
+
+flush_cache
+***********
+This routine sweeps a buffer that is twice the size of
+the last level cache
+(64 megabytes if the cache sizes are not available).
+The first sweep reads and then writes every cache line in the buffer.
+The second sweep reads every cache line in the buffer;
+this writes back the dirty lines from the first sweep,
+so the next computation does not pay for these write backs.
+The buffer is allocated the first time ``flush_cache`` is called.
+It is used by the :ref:`cpp_fun_speed@speed_option@Cold Caches` mode.
+
+Cold
+====
+After a call to ``flush_cache`` , the data that was in the caches has
+very likely been evicted from all the cache levels and the caches contain
+clean lines of the buffer.
+This is not guaranteed; e.g., the last level cache may not be inclusive
+and it may not use least recently used replacement.
+(The factor of two in the size of the buffer makes the eviction
+reliable in practice.)
+The translation lookaside buffer and the branch predictors are not flushed.
+
+{xrst_toc_hidden
+   cpp/xam/cache_info.cpp
+}
+Example
+*******
+:ref:`xam_cache_info.cpp-name` contains an example and test of
+these routines.
+
+{xrst_end cache_info}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <string>
+# include <fstream>
+# include <filesystem>
+# include <vector>
+# include <algorithm>
+# include <cmpad/cache_info.hpp>
+
+namespace {
+   // flush_sink_
+   // flush_cache stores a sum of the buffer here so the reads are not removed
+   volatile char flush_sink_ = 0;
+   //
+   // read_line
+   // first line of a file (empty if the file cannot be read)
+   std::string read_line(const std::filesystem::path& file_path)
+   {  std::ifstream file(file_path);
+      std::string   line;
+      if( file.good() )
+         std::getline(file, line);
+      return line;
+   }
+   //
+   // byte_of
+   // convert a size such as 48K or 2M to bytes (zero if not valid)
+   size_t byte_of(const std::string& size)
+   {  size_t value = 0;
+      size_t i      = 0;
+      while( i < size.size() && '0' <= size[i] && size[i] <= '9' )
+         value = 10 * value + size_t( size[i++] - '0' );
+      if( i == size.size() )
+         return value;
+      switch( size[i] )
+      {  case 'K':
+         return value << 10;
+         //
+         case 'M':
+         return value << 20;
+         //
+         case 'G':
+         return value << 30;
+         //
+         default:
+         break;
+      }
+      return 0;
+   }
+   //
+   // read_cache_size
+   cmpad::vector<size_t> read_cache_size(void)
+   {  namespace filesystem = std::filesystem;
+      cmpad::vector<size_t> size;
+      filesystem::path dir("/sys/devices/system/cpu/cpu0/cache");
+      for(size_t index = 0; ; ++index)
+      {  filesystem::path index_dir = dir / ( "index" + std::to_string(index) );
+         std::error_code ec;
+         if( ! filesystem::is_directory(index_dir, ec) )
+            break;
+         std::string type  = read_line(index_dir / "type");
+         size_t      level = size_t( std::atoi(
+            read_line(index_dir / "level").c_str()
+         ) );
+         size_t      byte  = byte_of( read_line(index_dir / "size") );
+         if( type != "Instruction" && 0 < level && 0 < byte )
+         {  while( size.size() < level )
+               size.push_back(0);
+            size[level - 1] = std::max(size[level - 1], byte);
+         }
+      }
+      //
+      // size
+      // a level that is missing makes the sizes unreliable
+      for(size_t level = 0; level < size.size(); ++level)
+      {  if( size[level] == 0 )
+            size.clear();
+      }
+      return size;
+   }
+}
+
+namespace cmpad {
+   //
+   // cache_size
+   const cmpad::vector<size_t>& cache_size(void)
+   {  static const cmpad::vector<size_t> size = read_cache_size();
+      return size;
+   }
+   //
+   // cache_level
+   size_t cache_level(double n_byte)
+   {  const cmpad::vector<size_t>& size = cache_size();
+      if( std::isnan(n_byte) || size.size() == 0 )
+         return 0;
+      size_t level = 0;
+      while( level < size.size() && double( size[level] ) < n_byte )
+         ++level;
+      return level + 1;
+   }
+   //
+   // flush_cache
+   void flush_cache(void)
+   {  //
+      // buffer
+      static std::vector<char> buffer;
+      if( buffer.size() == 0 )
+      {  const cmpad::vector<size_t>& size = cache_size();
+         size_t n_byte = size_t(32) << 20;
+         if( size.size() > 0 )
+            n_byte = size[ size.size() - 1 ];
+         buffer.resize(2 * n_byte);
+      }
+      //
+      // line_size
+      // (a smaller line size would also work, but take longer)
+      const size_t line_size = 64;
+      //
+      // buffer
+      // read and then write every line
+      volatile char* data = buffer.data();
+      for(size_t i = 0; i < buffer.size(); i += line_size)
+         data[i] = char( data[i] + 1 );
+      //
+      // flush_sink_
+      // read every line so the dirty lines above are written back now
+      char sum = 0;
+      for(size_t i = 0; i < buffer.size(); i += line_size)
+         sum = char( sum + data[i] );
+      flush_sink_ = sum;
+   }
+}
@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin case_sample}
+
+Group the Timing Samples in a Results File by Case
+##################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/case_sample.hpp>``
+| |tab| *key_name* = ``cmpad::case_key_name`` ()
+| |tab| *msg* = ``cmpad::case_sample`` ( *file_name* , *sample* , *order* )
+
+Prototype
+*********
+{xrst_literal
+   cpp/include/cmpad/case_sample.hpp
+   // BEGIN CASE_SAMPLE_T
+   // END CASE_SAMPLE_T
+}
+
+key_name
+********
+This ``const cmpad::vector<std::string>&`` contains the names of the
+:ref:`csv_column-name` that identify a case:
+package, algorithm, n_arg, n_other, time_setup, special, and flush_cache.
+Rows that differ in any of these columns are different cases;
+e.g., a row with special true, or with flush_cache true,
+is not in the same case as the corresponding normal row
+because its timings have a different distribution.
+If a column is not in the file, its value is empty for all the rows.
+The package, algorithm, and n_arg columns must be in the file.
+
+file_name
+*********
+This ``const std::string&`` is the name of a csv file
+written by :ref:`run_cmpad-name` .
+
+sample
+******
+The input value of this ``case_sample_t`` does not matter.
+Upon return, *sample* [ *key* ] is the samples for the case *key* ,
+where *key* [ *k* ] is the value of the column *key_name* [ *k* ] .
+The samples for a case are the :ref:`csv_column@time_sample` values
+for its rows.
+If a row does not have time_sample values, its
+:ref:`csv_column@time_median` is used as one sample.
+If it does not have a time_median, the reciprocal of its
+:ref:`csv_column@rate` is used.
+Thus a file with several rows for the same case, and no time_sample column,
+can also be used.
+
+order
+*****
+The input value of this ``cmpad::vector<case_key_t>`` does not matter.
+Upon return, it contains the cases in the order that they first
+appear in *file_name* .
+
+msg
+***
+This ``std::string`` is empty if no error occurred.
+Otherwise it is an error message; e.g.,
+if *file_name* cannot be read or one of its samples is not
+a positive number.
+
+{xrst_toc_hidden
+   cpp/xam/case_sample.cpp
+}
+Example
+*******
+:ref:`xam_case_sample.cpp-name` contains an example and test of this routine.
+
+{xrst_end case_sample}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cstdlib>
+# include <sstream>
+# include <cmpad/case_sample.hpp>
+# include <cmpad/csv_scan.hpp>
+
+namespace {
+   //
+   // to_double
+   // returns nan if text is not a number
+   double to_double(std::string_view text)
+   {  std::string str(text);
+      char*       end;
+      double      value = std::strtod(str.c_str(), &end);
+      if( str.empty() || *end != '\0' )
+         return std::nan("");
+      return value;
+   }
+}
+
+namespace cmpad {
+   //
+   // case_key_name
+   const cmpad::vector<std::string>& case_key_name(void)
+   {  static const cmpad::vector<std::string> key_name = {
+         "package",
+         "algorithm",
+         "n_arg",
+         "n_other",
+         "time_setup",
+         "special",
+         "flush_cache"
+      };
+      return key_name;
+   }
+   //
+   // case_sample
+   std::string case_sample(
+      const std::string&         file_name ,
+      case_sample_t&             sample    ,
+      cmpad::vector<case_key_t>& order     )
+   {  //
+      // sample, order
+      sample.clear();
+      order.clear();
+      //
+      // key_name, n_key
+      const cmpad::vector<std::string>& key_name = case_key_name();
+      size_t n_key = key_name.size();
+      //
+      // npos
+      const size_t npos = std::string::npos;
+      //
+      // key_col, sample_col, median_col, rate_col, msg
+      cmpad::vector<size_t> key_col(n_key, npos);
+      size_t      sample_col = npos;
+      size_t      median_col = npos;
+      size_t      rate_col   = npos;
+      std::string msg        = "";
+      //
+      // callback
+      auto callback = [&](
+         size_t index, const cmpad::vector<std::string_view>& row
+      )
+      {  if( index == 0 )
+         {  for(size_t j = 0; j < row.size(); ++j)
+            {  for(size_t k = 0; k < n_key; ++k)
+                  if( row[j] == key_name[k] )
+                     key_col[k] = j;
+               if( row[j] == "time_sample" )
+                  sample_col = j;
+               if( row[j] == "time_median" )
+                  median_col = j;
+               if( row[j] == "rate" )
+                  rate_col = j;
+            }
+            for(size_t k = 0; k < 3; ++k)
+            {  if( key_col[k] == npos )
+               {  msg = file_name + ": no " + key_name[k] + " column";
+                  return false;
+               }
+            }
+            return true;
+         }
+         //
+         // key
+         case_key_t key(n_key);
+         for(size_t k = 0; k < n_key; ++k)
+         {  if( key_col[k] < row.size() )
+               key[k] = std::string( row[ key_col[k] ] );
+         }
+         //
+         // value
+         cmpad::vector<double> value;
+         if( sample_col < row.size() )
+         {  std::stringstream ss( std::string( row[sample_col] ) );
+            std::string      text;
+            while( ss >> text )
+               value.push_back( to_double(text) );
+         }
+         if( value.size() == 0 && median_col < row.size() )
+         {  double median = to_double( row[median_col] );
+            if( ! std::isnan(median) )
+               value.push_back( median );
+         }
+         if( value.size() == 0 && rate_col < row.size() )
+         {  double rate = to_double( row[rate_col] );
+            if( 0.0 < rate )
+               value.push_back( 1.0 / rate );
+         }
+         //
+         // sample, order
+         for(size_t i = 0; i < value.size(); ++i)
+         {  if( ! (0.0 < value[i]) )
+            {  msg = file_name + ": row " + std::to_string(index)
+                  + " has a time that is not a positive number";
+               return false;
+            }
+         }
+         if( value.size() > 0 )
+         {  cmpad::vector<double>& vec = sample[key];
+            if( vec.size() == 0 )
+               order.push_back(key);
+            for(size_t i = 0; i < value.size(); ++i)
+               vec.push_back( value[i] );
+         }
+         return true;
+      };
+      if( ! cmpad::csv_scan(file_name, callback) )
+         return "cannot read " + file_name;
+      return msg;
+   }
+}
@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin cold_start}
+{xrst_spell
+   argv
+   execv
+   nan
+   obj
+   proc
+}
+
+Time to the First Gradient
+##########################
+
+Syntax
+******
+| |tab| ``# include <cmpad/cold_start.hpp>``
+| |tab| *status* = ``cmpad::cold_start_exec`` ( *argv* )
+| |tab| *child* = ``cmpad::cold_start_child`` ()
+| |tab| *cold* = ``cmpad::cold_start`` (
+  *test_obj* , *algo_obj* , *is_gradient* , *option*
+  )
+
+Purpose
+*******
+A program that only computes a few derivatives spends most of its time
+loading libraries, doing the first setup, and computing the first
+derivative with cold caches.
+These routines measure that time, from the start of a program to its
+first correct result, separately from the steady state rate
+measured by :ref:`cpp_fun_speed-name` .
+
+cold_start_exec
+***************
+This routine starts a new copy of the current program,
+with the same arguments, and waits for it to finish.
+The clock is read just before the call to ``execv`` and its value
+is passed to the new program using the ``CMPAD_COLD_START``
+environment variable.
+The copy is started using ``/proc/self/exe`` ,
+so this routine is only available on Linux.
+
+argv
+====
+This ``char*`` array has the arguments to the current program's
+``main`` routine.
+
+status
+======
+This ``int`` is the exit status of the new program,
+or minus one if it could not be started.
+
+cold_start_child
+****************
+The ``bool`` value *child* is true if the current program was started by
+``cold_start_exec`` ; i.e., if the ``CMPAD_COLD_START``
+environment variable is defined.
+Such a program should call ``cold_start`` and then exit.
+(It should not call ``cold_start_exec`` .)
+
+cold_start
+**********
+This routine does the first setup and the first computation for a
+function object, and then checks that the result is correct.
+
+test_obj
+========
+This function object has not yet been setup.
+The time for its first setup includes the time for any just in time
+compilation and dynamic loading that it does.
+The time for its first computation is done with cold caches in the
+sense that the function object has not been computed before.
+
+algo_obj
+========
+This function object is the algorithm that corresponds to *test_obj*
+(without any derivatives) and is used to check the result.
+It has not yet been setup.
+
+is_gradient
+===========
+If this ``bool`` is false, *test_obj* computes the same function as
+*algo_obj* and the result of the two function objects is compared.
+Otherwise, *test_obj* is a :ref:`gradient <cpp_gradient-name>` of *algo_obj*
+and its result is compared with a central difference approximation
+for the gradient of the last component of the range space of *algo_obj* .
+(The kind of function object cannot be determined from its domain and range;
+e.g., the domain and range of :ref:`an_ode <cpp_an_ode-name>`
+are the same.)
+
+option
+======
+This is the :ref:`option_t-name` used to setup both function objects.
+
+cold
+====
+This ``cmpad::cold_start_t`` object is defined by
+{xrst_literal
+   cpp/include/cmpad/cold_start.hpp
+   // BEGIN COLD_START_T
+   // END COLD_START_T
+}
+All of the times are in seconds:
+
+time_load
+---------
+is the time from the call to ``execv`` until the cmpad library was
+initialized; i.e., the time to load the program, the cmpad library,
+and the AD package libraries.
+It is ``nan`` if the current program was not started by
+``cold_start_exec`` .
+
+time_setup
+----------
+is the time for the first setup of *test_obj* .
+
+time_eval
+---------
+is the time for the first computation of *test_obj* .
+
+time_total
+----------
+is the time from the call to ``execv`` to the end of the first computation.
+If the current program was not started by ``cold_start_exec`` ,
+the time starts when the cmpad library was initialized.
+This includes the static initialization and the work done by ``main``
+before ``cold_start`` is called.
+
+correct
+-------
+is true if the result of the first computation is correct.
+
+{xrst_toc_hidden
+   cpp/xam/cold_start.cpp
+}
+Example
+*******
+:ref:`xam_cold_start.cpp-name` contains an example and test of
+these routines.
+
+{xrst_end cold_start}
+------------------------------------------------------------------------------
+*/
+# include <chrono>
+# include <cstdint>
+# include <cstdlib>
+# include <string>
+# include <sstream>
+# include <cmpad/cold_start.hpp>
+# include <cmpad/near_equal.hpp>
+# include <cmpad/uniform_01.hpp>
+
+# ifdef __linux__
+# include <unistd.h>
+# include <sys/wait.h>
+# endif
+
+namespace {
+   // steady_ns
+   int64_t steady_ns(void)
+   {  using std::chrono::steady_clock;
+      using std::chrono::nanoseconds;
+      steady_clock::duration now = steady_clock::now().time_since_epoch();
+      return std::chrono::duration_cast<nanoseconds>(now).count();
+   }
+   //
+   // init_ns_
+   // value of steady_ns when the cmpad library was initialized
+   const int64_t init_ns_ = steady_ns();
+   //
+   // env_name_
+   const char* env_name_ = "CMPAD_COLD_START";
+}
+
+namespace cmpad {
+   //
+   // cold_start_child
+   bool cold_start_child(void)
+   {  return std::getenv(env_name_) != nullptr;
+   }
+   //
+   // cold_start_exec
+   int cold_start_exec(char* argv[])
+   {  int status = -1;
+# ifdef __linux__
+      pid_t pid = fork();
+      if( pid < 0 )
+         return -1;
+      if( pid == 0 )
+      {  // child: the steady clock is the same for all processes
+         std::string start = std::to_string( steady_ns() );
+         setenv(env_name_, start.c_str(), 1);
+         execv("/proc/self/exe", argv);
+         _exit(127);
+      }
+      int wait_status;
+      if( waitpid(pid, &wait_status, 0) != pid )
+         return -1;
+      if( WIFEXITED(wait_status) )
+         status = WEXITSTATUS(wait_status);
+# endif
+      return status;
+   }
+   //
+   // cold_start
+   cold_start_t cold_start(
+      fun_obj< cmpad::vector<double> >& test_obj    ,
+      fun_obj< cmpad::vector<double> >& algo_obj    ,
+      bool                              is_gradient ,
+      const option_t&                   option      )
+   {  //
+      // cold, start_ns
+      cold_start_t cold;
+      int64_t start_ns = init_ns_;
+      const char* start = std::getenv(env_name_);
+      if( start != nullptr )
+      {  start_ns       = std::atoll(start);
+         cold.time_load = double(init_ns_ - start_ns) * 1e-9;
+      }
+      //
+      // test_obj
+      int64_t setup_ns = steady_ns();
+      test_obj.setup(option);
+      int64_t eval_ns  = steady_ns();
+      //
+      // x
+      // (not included in the timing)
+      cmpad::vector<double> x( test_obj.domain() );
+      uniform_01(x);
+      int64_t x_ns     = steady_ns();
+      //
+      // y
+      cmpad::vector<double> y = test_obj(x);
+      int64_t end_ns   = steady_ns();
+      //
+      // cold
+      cold.time_setup = double(eval_ns - setup_ns) * 1e-9;
+      cold.time_eval  = double(end_ns - x_ns) * 1e-9;
+      cold.time_total = double(end_ns - start_ns - (x_ns - eval_ns)) * 1e-9;
+      //
+      // algo_obj
+      algo_obj.setup(option);
+      //
+      // os
+      // the result is reported by cold.correct, not by near_equal messages
+      std::stringstream os;
+      //
+      // cold.correct
+      // same function: compare the values
+      if( ! is_gradient )
+      {  if( y.size() != algo_obj.range() )
+            return cold;
+         const cmpad::vector<double>& check = algo_obj(x);
+         cold.correct = true;
+         for(size_t i = 0; i < y.size(); ++i)
+            cold.correct &= near_equal(y[i], check[i], 1e-10, y, os);
+         return cold;
+      }
+      //
+      // cold.correct
+      // gradient: compare with a central difference for the last component
+      if( y.size() != x.size() || algo_obj.range() == 0 )
+         return cold;
+      size_t last  = algo_obj.range() - 1;
+      double step  = 1e-5;
+      cold.correct = true;
+      for(size_t j = 0; j < x.size(); ++j)
+      {  double x_j = x[j];
+         x[j]       = x_j + step;
+         double f_plus  = algo_obj(x)[last];
+         x[j]       = x_j - step;
+         double f_minus = algo_obj(x)[last];
+         x[j]       = x_j;
+         double diff    = (f_plus - f_minus) / (2.0 * step);
+         cold.correct  &= near_equal(y[j], diff, 1e-5, y, os);
+      }
+      return cold;
+   }
+}
@@ -0,0 +1,444 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin csv_append}
+{xrst_spell
+   flock
+   fsync
+}
+
+Append Rows to a Csv File That Is Shared by Several Processes
+#############################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/csv_append.hpp>``
+| |tab| ``cmpad::csv_append::enable_fsync`` ( *on* )
+| |tab| *on* = ``cmpad::csv_append::fsync_enabled`` ()
+| |tab| *ok* = ``cmpad::csv_append::rows`` (
+  *file_name* , *col_name* , *row_vec* , *extend*
+  )
+
+Purpose
+*******
+Reading a whole csv file, adding a row, and writing the whole file
+costs time proportional to the size of the file
+and loses rows when several processes share the same file.
+This routine appends rows to the end of the file using one ``write``
+to a file that was opened with ``O_APPEND`` ,
+while holding an exclusive ``flock`` lock on the file.
+Hence the cost of appending a row does not depend on the size of the file
+and several processes can safely append to the same file.
+The whole file is only rewritten when its header line does not have
+all the columns (see *extend* below).
+
+file_name
+*********
+This ``const std::string&`` is the name of the csv file.
+If it does not exist, it is created.
+The rows in this file are separated by newlines ``'\n'``
+and the columns are separated by commas ``','`` .
+
+col_name
+********
+This ``const cmpad::vector<std::string>&`` is the column names for the rows.
+If the file is empty, *col_name* is written as its header line.
+
+row_vec
+*******
+This ``const`` :ref:`vec_vec_str-name` ``&`` is the rows that are appended.
+The size of each row is the size of *col_name* and
+*row_vec* [ *i* ][ *j* ] is the value in the column *col_name* [ *j* ] .
+The rows are written in the order of the header line in the file;
+columns in the header line that are not in *col_name* have an empty value.
+
+extend
+******
+This ``bool`` determines what is done when the file is not empty
+and its header line is not the same as *col_name* :
+
+#. If *extend* is false, nothing is written and *ok* is false
+   (no message is printed in this case).
+#. If *extend* is true and all the names in *col_name* are in the header line,
+   the rows are appended as above.
+#. If *extend* is true and some of the names in *col_name* are not in the
+   header line, they are added to the end of the header line,
+   the previous rows get empty values for these columns,
+   and the whole file is rewritten (while holding the lock).
+   The new file is written to *file_name*\ ``.tmp`` ,
+   ``fsync`` is called on it, and it is renamed to *file_name* .
+   Hence *file_name* is never truncated
+   and a reader that has the old file open, or mapped,
+   continues to see the old file.
+   A process that was waiting for the lock on the old file
+   opens and locks the new file.
+
+ok
+**
+This ``bool`` is true if the rows were written.
+If the file cannot be opened, locked, or written,
+a message is printed on ``std::cerr`` , *ok* is false,
+and ``errno`` is not zero.
+If *ok* is false and ``errno`` is zero,
+the header line did not match (see *extend* above).
+
+fsync
+*****
+If *on* is true, ``fsync`` is called on the file after the rows
+are written (before the lock is released).
+This makes sure that the rows are on disk if the system crashes,
+but it is much slower.
+The initial value for *on* is false.
+
+Operating System
+****************
+The ``flock`` and ``O_APPEND`` features are only used on Unix systems.
+On other systems the file is read, the rows are added,
+and the whole file is rewritten.
+
+{xrst_toc_hidden
+   cpp/xam/csv_append.cpp
+}
+Example
+*******
+:ref:`xam_csv_append.cpp-name` contains an example and test of this routine.
+
+{xrst_end csv_append}
+------------------------------------------------------------------------------
+*/
+# include <cerrno>
+# include <iostream>
+# include <cmpad/csv_append.hpp>
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/csv_write.hpp>
+# include <cmpad/trace_event.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <cstdio>
+# include <cstring>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/file.h>
+# include <sys/stat.h>
+# else
+# include <filesystem>
+# include <cmpad/csv_read.hpp>
+# endif
+
+namespace {
+   // fsync_
+   bool fsync_ = false;
+# if defined(__unix__) || defined(__APPLE__)
+   //
+   // join_row
+   std::string join_row(const cmpad::vector<std::string>& row)
+   {  std::string line;
+      for(size_t j = 0; j < row.size(); ++j)
+      {  if( j > 0 )
+            line += ',';
+         line += cmpad::csv_field( row[j] );
+      }
+      line += '\n';
+      return line;
+   }
+   //
+   // align_rows
+   // text for the rows in row_vec using the column order in header
+   std::string align_rows(
+      const cmpad::vector<std::string>& header   ,
+      const cmpad::vector<std::string>& col_name ,
+      const cmpad::vector< cmpad::vector<std::string> >& row_vec )
+   {  std::string text;
+      for(size_t i = 0; i < row_vec.size(); ++i)
+      {  cmpad::vector<std::string> row( header.size() );
+         for(size_t k = 0; k < header.size(); ++k)
+         {  for(size_t j = 0; j < col_name.size(); ++j)
+            {  if( header[k] == col_name[j] )
+                  row[k] = row_vec[i][j];
+            }
+         }
+         text += join_row(row);
+      }
+      return text;
+   }
+   //
+   // to_string
+   cmpad::vector<std::string> to_string(
+      const cmpad::vector<std::string_view>& row_view )
+   {  cmpad::vector<std::string> row( row_view.size() );
+      for(size_t j = 0; j < row_view.size(); ++j)
+         row[j] = row_view[j];
+      return row;
+   }
+   //
+   // write_all
+   bool write_all(int fd, const std::string& text)
+   {  const char* data = text.data();
+      size_t      left = text.size();
+      while( left > 0 )
+      {  ssize_t n_write = write(fd, data, left);
+         if( n_write < 0 && errno == EINTR )
+            continue;
+         if( n_write <= 0 )
+            return false;
+         data += n_write;
+         left -= size_t(n_write);
+      }
+      return true;
+   }
+   //
+   // read_file
+   // contents of the file starting at offset zero, up to and including
+   // the first newline if first_line is true
+   std::string read_file(int fd, bool first_line)
+   {  std::string text;
+      char   buffer[4096];
+      off_t  offset = 0;
+      while( true )
+      {  ssize_t n_read = pread(fd, buffer, sizeof(buffer), offset);
+         if( n_read < 0 && errno == EINTR )
+            continue;
+         if( n_read <= 0 )
+            return text;
+         text.append(buffer, size_t(n_read) );
+         offset += n_read;
+         if( first_line )
+         {  size_t newline = text.find('\n');
+            if( newline != std::string::npos )
+               return text.substr(0, newline + 1);
+         }
+      }
+   }
+   //
+   // append_locked
+   // the file is open and locked
+   bool append_locked(
+      const std::string&                                  file_name ,
+      int                                                 fd        ,
+      const cmpad::vector<std::string>&                   col_name  ,
+      const cmpad::vector< cmpad::vector<std::string> >& row_vec   ,
+      bool                                                extend    )
+   {  //
+      // file_size
+      struct stat status;
+      if( fstat(fd, &status) != 0 )
+         return false;
+      off_t file_size = status.st_size;
+      //
+      // empty file
+      if( file_size == 0 )
+      {  std::string text = join_row(col_name);
+         text            += align_rows(col_name, col_name, row_vec);
+         return write_all(fd, text);
+      }
+      //
+      // header
+      cmpad::vector<std::string> header;
+      cmpad::csv_scan_text( read_file(fd, true),
+         [&header](size_t, const cmpad::vector<std::string_view>& row)
+         {  header = to_string(row);
+            return false;
+         }
+      );
+      //
+      // missing
+      bool same    = header == col_name;
+      bool missing = false;
+      for(size_t j = 0; j < col_name.size(); ++j)
+      {  bool found = false;
+         for(size_t k = 0; k < header.size(); ++k)
+            found |= header[k] == col_name[j];
+         missing |= ! found;
+      }
+      if( ! same && ! extend )
+         return false;
+      //
+      // append
+      if( ! missing )
+      {  //
+         // text
+         // start a new line if the last line does not end with a newline
+         std::string text;
+         char last;
+         if( pread(fd, &last, 1, file_size - 1) == 1 && last != '\n' )
+            text = "\n";
+         text += align_rows(header, col_name, row_vec);
+         return write_all(fd, text);
+      }
+      //
+      // header
+      for(size_t j = 0; j < col_name.size(); ++j)
+      {  bool found = false;
+         for(size_t k = 0; k < header.size(); ++k)
+            found |= header[k] == col_name[j];
+         if( ! found )
+            header.push_back( col_name[j] );
+      }
+      //
+      // text
+      // previous rows have empty values for the new columns
+      std::string text = join_row(header);
+      cmpad::csv_scan_text( read_file(fd, false),
+         [&](size_t index, const cmpad::vector<std::string_view>& row_view)
+         {  if( index == 0 )
+               return true;
+            cmpad::vector<std::string> row = to_string(row_view);
+            while( row.size() < header.size() )
+               row.push_back("");
+            text += join_row(row);
+            return true;
+         }
+      );
+      text += align_rows(header, col_name, row_vec);
+      //
+      // temp_name
+      // the new file is written to temp_name and then renamed to file_name,
+      // so file_name is never truncated and readers keep the old file
+      std::string temp_name = file_name + ".tmp";
+      int temp_fd = open(
+         temp_name.c_str(),
+         O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+         status.st_mode & 0777
+      );
+      if( temp_fd < 0 )
+         return false;
+      bool ok = write_all(temp_fd, text);
+      if( ok )
+         ok = fsync(temp_fd) == 0;
+      int error = errno;
+      close(temp_fd);
+      if( ok )
+      {  ok    = rename( temp_name.c_str(), file_name.c_str() ) == 0;
+         error = errno;
+      }
+      if( ! ok )
+      {  unlink( temp_name.c_str() );
+         errno = error;
+      }
+      return ok;
+   }
+# endif
+}
+
+namespace cmpad {
+   // enable_fsync
+   void csv_append::enable_fsync(bool on)
+   {  fsync_ = on; }
+   //
+   // fsync_enabled
+   bool csv_append::fsync_enabled(void)
+   {  return fsync_; }
+   //
+   // rows
+   bool csv_append::rows(
+      const std::string&                file_name ,
+      const cmpad::vector<std::string>& col_name  ,
+      const vec_vec_str&                row_vec   ,
+      bool                              extend    )
+   {  //
+      // span
+      trace_event span("csv_append", "csv");
+# if defined(__unix__) || defined(__APPLE__)
+      //
+      // fd
+      // the file is open and locked
+      int fd = -1;
+      while( fd < 0 )
+      {  fd = open(
+            file_name.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644
+         );
+         if( fd < 0 )
+         {  std::cerr << "csv_append: error opening " << file_name
+               << ": " << std::strerror(errno) << "\n";
+            return false;
+         }
+         //
+         // lock
+         int result = flock(fd, LOCK_EX);
+         while( result != 0 && errno == EINTR )
+            result = flock(fd, LOCK_EX);
+         if( result != 0 )
+         {  int error = errno;
+            std::cerr << "csv_append: error locking " << file_name
+               << ": " << std::strerror(error) << "\n";
+            close(fd);
+            errno = error;
+            return false;
+         }
+         //
+         // fd
+         // If another process replaced the file while this one was waiting
+         // for the lock, open and lock the new file.
+         struct stat fd_status, name_status;
+         bool same = fstat(fd, &fd_status) == 0;
+         same     &= stat(file_name.c_str(), &name_status) == 0;
+         same     &= fd_status.st_dev == name_status.st_dev;
+         same     &= fd_status.st_ino == name_status.st_ino;
+         if( ! same )
+         {  flock(fd, LOCK_UN);
+            close(fd);
+            fd = -1;
+         }
+      }
+      //
+      // ok
+      // errno is zero when the header line does not match
+      errno   = 0;
+      bool ok = append_locked(file_name, fd, col_name, row_vec, extend);
+      if( ok && fsync_ )
+         ok = fsync(fd) == 0;
+      int error = errno;
+      if( ! ok && error != 0 )
+      {  std::cerr << "csv_append: error writing " << file_name
+            << ": " << std::strerror(error) << "\n";
+      }
+      //
+      // unlock
+      flock(fd, LOCK_UN);
+      close(fd);
+      //
+      // errno
+      // zero if and only if a failure is due to the header line
+      errno = error;
+      return ok;
+# else
+      //
+      // csv_table
+      vec_vec_str csv_table;
+      if( std::filesystem::exists( std::filesystem::path(file_name) ) )
+         csv_table = csv_read(file_name);
+      if( csv_table.size() == 0 )
+         csv_table.push_back(col_name);
+      if( csv_table[0] != col_name && ! extend )
+      {  errno = 0;
+         return false;
+      }
+      cmpad::vector<std::string>& header = csv_table[0];
+      for(size_t j = 0; j < col_name.size(); ++j)
+      {  bool found = false;
+         for(size_t k = 0; k < header.size(); ++k)
+            found |= header[k] == col_name[j];
+         if( ! found )
+            header.push_back( col_name[j] );
+      }
+      for(size_t i = 1; i < csv_table.size(); ++i)
+      {  while( csv_table[i].size() < header.size() )
+            csv_table[i].push_back("");
+      }
+      for(size_t i = 0; i < row_vec.size(); ++i)
+      {  cmpad::vector<std::string> row( header.size() );
+         for(size_t k = 0; k < header.size(); ++k)
+         {  for(size_t j = 0; j < col_name.size(); ++j)
+            {  if( header[k] == col_name[j] )
+                  row[k] = row_vec[i][j];
+            }
+         }
+         csv_table.push_back(row);
+      }
+      csv_write(file_name, csv_table);
+      return true;
+# endif
+   }
+}
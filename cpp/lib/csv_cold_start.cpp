@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin csv_cold_start}
+
+Record a Cold Start Measurement in a Csv File
+#############################################
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+The time to the first gradient is very different from the steady state
+rate in :ref:`csv_column-name` , so it is recorded in a separate file.
+
+file_name
+*********
+This is the name of the file were the measurement will be recorded.
+If the file is empty on input, the following header line is written
+as its first line:
+{xrst_spell_off}
+{xrst_code csv}
+package,algorithm,n_arg,n_other,special,date,cold_load,cold_setup,cold_eval,cold_total,correct
+{xrst_code}
+{xrst_spell_on}
+If the file is not empty, its header line must be the same as above.
+One row is added to the end of the file.
+
+cold
+****
+This is the :ref:`cold_start@cold_start@cold` measurement that is recorded.
+The *cold_load* , *cold_setup* , *cold_eval* and *cold_total*
+columns are the
+:ref:`cold_start@cold_start@cold@time_load` ,
+:ref:`cold_start@cold_start@cold@time_setup` ,
+:ref:`cold_start@cold_start@cold@time_eval` , and
+:ref:`cold_start@cold_start@cold@time_total` fields.
+A ``nan`` value is recorded as an empty value.
+The *correct* column is ``true`` or ``false`` .
+
+package, algorithm, special, option
+***********************************
+These values identify the case that the measurement corresponds to;
+see :ref:`csv_column@package` ,
+:ref:`csv_column@algorithm` ,
+:ref:`csv_column@special` ,
+:ref:`csv_column@n_arg` , and
+:ref:`csv_column@n_other` .
+
+date
+****
+see :ref:`csv_column@date` .
+
+{xrst_toc_hidden
+   cpp/xam/csv_cold_start.cpp
+}
+Example
+*******
+:ref:`xam_csv_cold_start.cpp-name` contains an example and test of
+this routine.
+
+{xrst_end csv_cold_start}
+*/
+# include <cerrno>
+# include <cmath>
+# include <ctime>
+# include <iomanip>
+# include <iostream>
+# include <sstream>
+# include <cmpad/csv_cold_start.hpp>
+# include <cmpad/csv_append.hpp>
+
+namespace {
+   // seconds2string
+   std::string seconds2string(double seconds)
+   {  if( std::isnan(seconds) )
+         return "";
+      std::stringstream ss;
+      ss << std::setprecision(3) << std::scientific << seconds;
+      return ss.str();
+   }
+}
+
+namespace cmpad { // BEGIN_CMPAD_NAMESPACE
+
+// BEGIN PROTOTYPE
+void csv_cold_start(
+   const std::string&       file_name ,
+   const cold_start_t&      cold      ,
+   const std::string&       package   ,
+   const std::string&       algorithm ,
+   bool                     special   ,
+   const option_t&          option    )
+// END PROTOTYPE
+{  //
+   // col_name
+   cmpad::vector<std::string> col_name = {
+      "package",
+      "algorithm",
+      "n_arg",
+      "n_other",
+      "special",
+      "date",
+      "cold_load",
+      "cold_setup",
+      "cold_eval",
+      "cold_total",
+      "correct"
+   };
+   //
+   // row_vec
+   vec_vec_str row_vec;
+   //
+   // date
+   std::time_t rawtime;
+   std::time ( &rawtime );
+   struct tm*  ptm = std::localtime( &rawtime );
+   int year  = ptm->tm_year + 1900;
+   int month = ptm->tm_mon + 1;
+   int day   = ptm->tm_mday;
+   std::stringstream ss;
+   ss << year << '-' << month << '-' << day;
+   std::string date = ss.str();
+   //
+   // row_vec
+   cmpad::vector<std::string> row = {
+      package,
+      algorithm,
+      std::to_string(option.n_arg),
+      std::to_string(option.n_other),
+      special ? "true" : "false",
+      date,
+      seconds2string(cold.time_load),
+      seconds2string(cold.time_setup),
+      seconds2string(cold.time_eval),
+      seconds2string(cold.time_total),
+      cold.correct ? "true" : "false"
+   };
+   row_vec.push_back(row);
+   //
+   // file_name
+   // csv_append::rows prints a message when errno is not zero
+   if( ! csv_append::rows(file_name, col_name, row_vec, false) )
+   {  if( errno == 0 )
+      {  std::cerr << "csv_cold_start: the header line in " << file_name
+            << "\nis not the header line for a cold start file\n";
+      }
+      std::exit(1);
+   }
+}
+
+} // END_CMPAD_NAMESPACE
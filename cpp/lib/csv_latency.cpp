@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin csv_latency}
+
+Record a Latency Histogram in a Csv File
+########################################
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+The :ref:`csv_column@Latency` columns only contain a few percentiles.
+This routine records all the non-empty buckets in a
+:ref:`latency_histogram-name` so that the tails of the latency
+distributions for different packages can be compared.
+
+file_name
+*********
+This is the name of the file were the buckets will be recorded.
+If the file is empty on input, the following header line is written
+as its first line:
+{xrst_spell_off}
+{xrst_code csv}
+package,algorithm,n_arg,n_other,time_setup,special,lower,upper,count
+{xrst_code}
+{xrst_spell_on}
+If the file is not empty, its header line must be the same as above.
+A row is added to the file for each bucket that has a non-zero count.
+
+latency
+*******
+This is the histogram that is recorded.
+The *lower* , *upper* and *count* columns are the
+:ref:`latency_histogram@index@lower` ,
+:ref:`latency_histogram@index@upper` , and
+:ref:`latency_histogram@index@count` for a bucket.
+
+package, algorithm, special, option
+***********************************
+These values identify the case that the histogram corresponds to;
+see :ref:`csv_column@package` ,
+:ref:`csv_column@algorithm` ,
+:ref:`csv_column@special` ,
+:ref:`csv_column@n_arg` ,
+:ref:`csv_column@n_other` , and
+:ref:`csv_column@time_setup` .
+
+{xrst_toc_hidden
+   cpp/xam/csv_latency.cpp
+}
+Example
+*******
+:ref:`xam_csv_latency.cpp-name` contains an example and test of this routine.
+
+{xrst_end csv_latency}
+*/
+# include <cerrno>
+# include <iomanip>
+# include <iostream>
+# include <sstream>
+# include <cmpad/csv_latency.hpp>
+# include <cmpad/csv_append.hpp>
+
+namespace cmpad { // BEGIN_CMPAD_NAMESPACE
+
+// BEGIN PROTOTYPE
+void csv_latency(
+   const std::string&       file_name ,
+   const latency_histogram& latency   ,
+   const std::string&       package   ,
+   const std::string&       algorithm ,
+   bool                     special   ,
+   const option_t&          option    )
+// END PROTOTYPE
+{  //
+   // col_name
+   cmpad::vector<std::string> col_name = {
+      "package",
+      "algorithm",
+      "n_arg",
+      "n_other",
+      "time_setup",
+      "special",
+      "lower",
+      "upper",
+      "count"
+   };
+   //
+   // row_vec
+   vec_vec_str row_vec;
+   //
+   // n_arg, n_other, time_setup, special_str
+   std::string n_arg       = std::to_string(option.n_arg);
+   std::string n_other     = std::to_string(option.n_other);
+   std::string time_setup  = option.time_setup ? "true" : "false";
+   std::string special_str = special ? "true" : "false";
+   //
+   // row_vec
+   std::stringstream ss;
+   ss << std::setprecision(3) << std::scientific;
+   for(size_t index = 0; index < latency_histogram::n_bucket; ++index)
+   {  uint64_t count = latency.count(index);
+      if( count > 0 )
+      {  //
+         // lower, upper
+         ss.str("");
+         ss << latency.lower(index);
+         std::string lower = ss.str();
+         ss.str("");
+         ss << latency.upper(index);
+         std::string upper = ss.str();
+         //
+         // row_vec
+         cmpad::vector<std::string> row = {
+            package,
+            algorithm,
+            n_arg,
+            n_other,
+            time_setup,
+            special_str,
+            lower,
+            upper,
+            std::to_string(count)
+         };
+         row_vec.push_back(row);
+      }
+   }
+   //
+   // file_name
+   // csv_append::rows prints a message when errno is not zero
+   if( ! csv_append::rows(file_name, col_name, row_vec, false) )
+   {  if( errno == 0 )
+      {  std::cerr << "csv_latency: the header line in " << file_name
+            << "\nis not the header line for a latency file\n";
+      }
+      std::exit(1);
+   }
+}
+
+} // END_CMPAD_NAMESPACE
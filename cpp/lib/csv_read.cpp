@@ -30,17 +30,26 @@ Each row in this file ends with a newlines ``'\n'``.
 The columns are separated by commas ``','`` .
 A comma at the end of a line means there is an empty value
 at the end of the corresponding row.
-There are no other special characters in this file.
+A carriage return ``'\r'`` directly before the newline is ignored
+(the python csv module uses ``"\r\n"`` to terminate rows).
+A value that contains commas, newlines, or double quotes is surrounded
+by double quotes; see :ref:`csv_scan@Format` .
 
 csv_table
 *********
 #. The *j*-th column of the *i*-th row of the file contains the value
-   csv_table[i][j] . The special characters ``'\n'`` and ``','`` are
-   not included in these values.
+   csv_table[i][j] . The special characters ``'\n'`` and ``','`` ,
+   that separate rows and columns, are not included in these values.
 #. The row and column indices start at zero.
 #. csv_table.size() is the number of rows in the table
 #. csv_table[i].size() is the number of columns in the *i*-th row.
 
+Large Files
+***********
+This routine copies every value in the file.
+The :ref:`csv_scan-name` routine can be used to filter the rows
+of a large file without copying them.
+
 {xrst_toc_hidden
    cpp/xam/csv_read.cpp
 }
@@ -53,62 +62,33 @@ Example
 */
 
 # include <string>
-# include <fstream>
-# include <iostream>
+# include <utility>
 # include <cassert>
 # include <cmpad/csv_read.hpp>
-
-namespace {
-   // get_row
-   cmpad::vector<std::string> get_row(std::ifstream& ifs)
-   {  // line
-      std::string line;
-      std::getline(ifs, line);
-      //
-      // row
-      cmpad::vector<std::string> row;
-      if( (ifs.rdstate() & std::ifstream::eofbit) != 0 )
-         return row;
-      //
-      // row
-      size_t previous = 0;
-      size_t next     = line.find(',', previous);
-      while( next != std::string::npos )
-      {  row.push_back( line.substr(previous, next - previous) );
-         previous = next + 1;
-         next     = line.find(',', previous);
-      }
-      row.push_back( line.substr(previous, line.size() ) );
-      //
-      return row;
-   }
-}
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/trace_event.hpp>
 
 namespace cmpad {
    // BEGIN PROTOTYPE
    vec_vec_str csv_read(const std::string& file_name)
    // END PROTOTYPE
    {  //
+      // span
+      trace_event span("csv_read", "csv");
+      //
       // csv_table
       vec_vec_str csv_table;
-      //
-      // ifs
-      std::ifstream ifs(file_name);
-      if( ( ifs.rdstate() & std::ifstream::failbit ) != 0 )
-      {  std::cerr << "csv_table.read: error opening " << file_name
-            << " for reading\n";
+      auto callback = [&csv_table](
+         size_t, const cmpad::vector<std::string_view>& row_view
+      )
+      {  cmpad::vector<std::string> row( row_view.size() );
+         for(size_t j = 0; j < row_view.size(); ++j)
+            row[j] = row_view[j];
+         csv_table.push_back( std::move(row) );
+         return true;
+      };
+      if( ! csv_scan(file_name, callback) )
          assert(false);
-      }
-      // csv_table
-      cmpad::vector<std::string> row;
-      row = get_row(ifs);
-      while( row.size() > 0 )
-      {  csv_table.push_back(row);
-         row = get_row(ifs);
-      }
-      //
-      // ifs
-      ifs.close();
       //
       // BEGIN RETURN
       // ...
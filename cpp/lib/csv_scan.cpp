@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin csv_scan}
+{xrst_spell
+   mmap
+   newlines
+   th
+}
+
+Scan the Rows of a Csv File Without Copying Them
+################################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/csv_scan.hpp>``
+| |tab| *ok* = ``cmpad::csv_scan`` ( *file_name* , *callback* )
+| |tab| ``cmpad::csv_scan_text`` ( *text* , *callback* )
+
+Purpose
+*******
+The results history in a csv file can be large and
+:ref:`csv_read-name` copies every value in the file.
+This routine maps the file into memory (using ``mmap`` )
+and passes each row to *callback* as a vector of views into the file.
+Hence an analysis can filter the rows without creating the whole table.
+A shared ``flock`` is held on the file while it is mapped;
+:ref:`csv_append-name` holds an exclusive lock while it changes the file.
+
+file_name
+*********
+This ``const std::string&`` is the name of the csv file.
+
+text
+****
+This ``std::string_view`` contains the csv text to scan
+(instead of a file).
+
+Format
+******
+The file uses the format in RFC 4180:
+
+#. Each row ends with a newline ``'\n'`` .
+   A carriage return ``'\r'`` directly before the newline is ignored.
+   The last row does not need to end with a newline.
+#. The fields in a row are separated by commas ``','`` .
+   A comma at the end of a line means there is an empty value
+   at the end of the corresponding row.
+#. A field that starts with a double quote ``'"'`` ends at the next
+   double quote that is not doubled.
+   Commas and newlines between the double quotes are part of the value.
+   The double quotes that surround the field are not part of the value
+   and a doubled double quote ``""`` in the field is one double quote
+   in the value.
+
+callback
+********
+This ``const csv_callback_t&`` is called once for each row, where
+{xrst_literal
+   cpp/include/cmpad/csv_scan.hpp
+   // BEGIN CSV_CALLBACK_T
+   // END CSV_CALLBACK_T
+}
+
+index
+=====
+is the index of this row in the file; i.e., zero for the first row
+(the header line).
+
+row
+===
+*row* [ *j* ] is the value of the *j*-th field in this row.
+The views are only valid during the call to *callback* ;
+i.e., a value must be copied if it is used after *callback* returns.
+
+return
+======
+If *callback* returns false, the scan stops and the rest of the rows
+are not passed to *callback* .
+
+ok
+**
+This ``bool`` is false if *file_name* cannot be opened or mapped.
+In this case an error message is printed on ``std::cerr`` .
+
+Operating System
+****************
+The file is only mapped on Unix systems.
+On other systems it is read into memory.
+
+{xrst_toc_hidden
+   cpp/xam/csv_scan.cpp
+}
+Example
+*******
+:ref:`xam_csv_scan.cpp-name` contains an example and test of this routine.
+
+{xrst_end csv_scan}
+------------------------------------------------------------------------------
+*/
+# include <cstring>
+# include <iostream>
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/trace_event.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <cerrno>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/file.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# else
+# include <fstream>
+# include <sstream>
+# endif
+
+namespace cmpad {
+   // csv_scan_text
+   void csv_scan_text(std::string_view text, const csv_callback_t& callback)
+   {  //
+      // data, n
+      const char* data = text.data();
+      size_t      n    = text.size();
+      //
+      // row
+      cmpad::vector<std::string_view> row;
+      //
+      // unquote, n_unquote
+      // values that had doubled double quotes, for the current row
+      cmpad::vector<std::string> unquote;
+      size_t                     n_unquote = 0;
+      //
+      // field_of
+      // field_of[k] is the index in row for unquote[k]
+      cmpad::vector<size_t> field_of;
+      //
+      // pos, index
+      size_t pos   = 0;
+      size_t index = 0;
+      while( pos < n )
+      {  row.clear();
+         field_of.clear();
+         n_unquote = 0;
+         //
+         bool end_row = false;
+         while( ! end_row )
+         {  //
+            // start, end, doubled
+            size_t start, end;
+            bool   doubled = false;
+            if( pos < n && data[pos] == '"' )
+            {  // quoted field
+               start = ++pos;
+               end   = n;
+               while( pos < n )
+               {  const void* quote = std::memchr(data + pos, '"', n - pos);
+                  if( quote == nullptr )
+                  {  pos = n;
+                     break;
+                  }
+                  pos = size_t( static_cast<const char*>(quote) - data );
+                  if( pos + 1 < n && data[pos + 1] == '"' )
+                  {  doubled = true;
+                     pos    += 2;
+                  }
+                  else
+                  {  end = pos;
+                     ++pos;
+                     break;
+                  }
+               }
+               //
+               // pos
+               // skip characters between the closing quote and the delimiter
+               while( pos < n && data[pos] != ',' && data[pos] != '\n' )
+                  ++pos;
+            }
+            else
+            {  // field without quotes
+               start = pos;
+               while( pos < n && data[pos] != ',' && data[pos] != '\n' )
+                  ++pos;
+               end = pos;
+               if( (pos == n || data[pos] == '\n') &&
+                  start < end && data[end - 1] == '\r' )
+                  --end;
+            }
+            //
+            // row
+            if( ! doubled )
+               row.push_back( std::string_view(data + start, end - start) );
+            else
+            {  if( unquote.size() <= n_unquote )
+                  unquote.resize(n_unquote + 1);
+               std::string& value = unquote[n_unquote++];
+               value.clear();
+               for(size_t i = start; i < end; ++i)
+               {  value += data[i];
+                  if( data[i] == '"' )
+                     ++i;
+               }
+               field_of.push_back( row.size() );
+               row.push_back( std::string_view() );
+            }
+            //
+            // pos, end_row
+            if( pos < n && data[pos] == ',' )
+               ++pos;
+            else
+            {  if( pos < n )
+                  ++pos;
+               end_row = true;
+            }
+         }
+         //
+         // row
+         // unquote is not resized after this point in the row
+         for(size_t k = 0; k < field_of.size(); ++k)
+            row[ field_of[k] ] = unquote[k];
+         //
+         // callback
+         if( ! callback(index++, row) )
+            return;
+      }
+   }
+   //
+   // csv_scan
+   bool csv_scan(const std::string& file_name, const csv_callback_t& callback)
+   {  //
+      // span
+      trace_event span("csv_scan", "csv");
+# if defined(__unix__) || defined(__APPLE__)
+      //
+      // fd
+      int fd = open(file_name.c_str(), O_RDONLY | O_CLOEXEC);
+      if( fd < 0 )
+      {  std::cerr << "csv_scan: error opening " << file_name
+            << " for reading: " << std::strerror(errno) << "\n";
+         return false;
+      }
+      //
+      // lock
+      // a shared lock, so csv_append does not change the file while it is
+      // mapped (if locking is not supported, the file is scanned anyway)
+      int result = flock(fd, LOCK_SH);
+      while( result != 0 && errno == EINTR )
+         result = flock(fd, LOCK_SH);
+      //
+      // size
+      struct stat status;
+      if( fstat(fd, &status) != 0 )
+      {  std::cerr << "csv_scan: error reading " << file_name
+            << ": " << std::strerror(errno) << "\n";
+         close(fd);
+         return false;
+      }
+      size_t size = size_t( status.st_size );
+      if( size == 0 )
+      {  close(fd);
+         return true;
+      }
+      //
+      // map
+      void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if( map == MAP_FAILED )
+      {  std::cerr << "csv_scan: error mapping " << file_name
+            << ": " << std::strerror(errno) << "\n";
+         close(fd);
+         return false;
+      }
+      madvise(map, size, MADV_SEQUENTIAL);
+      //
+      // unmap
+      // the mapping is removed, and the lock released,
+      // even if callback throws an exception
+      struct unmap_t {
+         void*  map;
+         size_t size;
+         int    fd;
+         ~unmap_t(void)
+         {  munmap(map, size);
+            close(fd);
+         }
+      } unmap = { map, size, fd };
+      //
+      // callback
+      csv_scan_text(
+         std::string_view(static_cast<const char*>(map), size), callback
+      );
+      return true;
+# else
+      //
+      // ifs
+      std::ifstream ifs(file_name, std::ios::binary);
+      if( ( ifs.rdstate() & std::ifstream::failbit ) != 0 )
+      {  std::cerr << "csv_scan: error opening " << file_name
+            << " for reading\n";
+         return false;
+      }
+      //
+      // callback
+      std::stringstream ss;
+      ss << ifs.rdbuf();
+      std::string text = ss.str();
+      csv_scan_text(text, callback);
+      return true;
+# endif
+   }
+}
@@ -10,9 +10,9 @@ Record a C++ Speed Result in a Csv File
 
 Prototype
 *********
-{xrst_literal
-   // BEGIN PROTOTYPE
-   // END PROTOTYPE
+{xrst_literal ,
+   // BEGIN PROTOTYPE, // END PROTOTYPE
+   // BEGIN RATE PROTOTYPE, // END RATE PROTOTYPE
 }
 
 
@@ -29,12 +29,86 @@ This file uses the :ref:`csv_column-name` format.
       END HEADER_LINE
    }
 
+#. If the file is not empty on input, the columns in its header line
+   are matched by name.
+   Columns that are not in its header line are added to the end of the
+   header line and the previous rows have an empty value for these columns.
+   Columns that are in its header line, but not written by this routine,
+   have an empty value in the new row.
+
 #. A line is added to this file corresponding to
    this call to csv_speed.
+   It is appended to the end of the file while holding a lock on the file;
+   see :ref:`csv_append-name` .
+   The whole file is only rewritten when columns are added to its header line.
+
+#. If the :ref:`results_store@set_speed_dir` directory is not empty,
+   the row is also appended to the corresponding binary store.
+
+speed
+*****
+This :ref:`speed_result_t-name` object is the result of the speed test.
+Its fields are recorded in the following columns:
+:ref:`csv_column@rate` ,
+:ref:`csv_column@n_warmup` ,
+:ref:`csv_column@n_sample` ,
+:ref:`csv_column@n_pool` ,
+:ref:`csv_column@n_outlier` ,
+:ref:`csv_column@time_median` ,
+:ref:`csv_column@time_mad` ,
+:ref:`csv_column@time_min` ,
+:ref:`csv_column@time_lower` ,
+:ref:`csv_column@time_upper` ,
+:ref:`csv_column@time_init` ,
+:ref:`csv_column@break_even` ,
+:ref:`csv_column@n_op` ,
+:ref:`csv_column@n_var` ,
+:ref:`csv_column@tape_bytes` ,
+:ref:`csv_column@work_bytes` ,
+:ref:`csv_column@alloc_setup` ,
+:ref:`csv_column@byte_setup` ,
+:ref:`csv_column@alloc_eval` ,
+:ref:`csv_column@byte_eval` ,
+:ref:`csv_column@max_rss` ,
+:ref:`csv_column@clock` ,
+:ref:`csv_column@time_overhead` ,
+:ref:`csv_column@rel_error` ,
+:ref:`csv_column@ctx_switch` ,
+:ref:`csv_column@page_fault` ,
+:ref:`csv_column@cpu` ,
+:ref:`csv_column@governor` ,
+:ref:`csv_column@turbo` ,
+:ref:`csv_column@load_avg` .
+If *speed*\ ``.perf_count`` is not empty, it is recorded in the
+:ref:`csv_column@Performance Counters` columns;
+otherwise these columns are not added to the file.
+If *speed*\ ``.setup_phase`` is not empty, it is recorded in the
+:ref:`csv_column@Setup Phases` columns.
+If *speed*\ ``.latency`` is not empty, it is recorded in the
+:ref:`csv_column@Latency` columns;
+otherwise these columns are not added to the file.
+If *speed*\ ``.ratio_base`` is not empty, the ratio fields are recorded in the
+:ref:`csv_column@Ratio` columns;
+otherwise these columns are not added to the file.
+If *speed*\ ``.static_ratio`` is not ``nan`` , it is recorded in the
+:ref:`csv_column@static_ratio` column;
+otherwise this column is not added to the file.
+The same holds for *speed*\ ``.grad_ratio`` and the
+:ref:`csv_column@grad_ratio` column,
+for *speed*\ ``.n_flop`` , ``.gflops`` , ``.efficiency`` and the
+:ref:`csv_column@n_flop` , :ref:`csv_column@gflops` ,
+:ref:`csv_column@efficiency` columns,
+and for *speed*\ ``.cache_level`` and the
+:ref:`csv_column@cache_level` column.
+If *speed*\ ``.flush_cache`` is true, it is recorded in the
+:ref:`csv_column@flush_cache` column;
+otherwise this column is not added to the file.
 
 rate
 ****
-see :ref:`csv_column@rate`
+see :ref:`csv_column@rate` .
+If *rate* is used in place of *speed* ,
+the columns that correspond to the other fields in *speed* are empty.
 
 min_time
 ********
@@ -77,12 +151,16 @@ Example
 {xrst_end cpp_csv_speed}
 */
 # include <ctime>
+# include <cmath>
+# include <cassert>
+# include <iomanip>
 # include <filesystem>
 # include <sstream>
 # include <iostream>
 # include <cmpad/csv_speed.hpp>
-# include <cmpad/csv_read.hpp>
-# include <cmpad/csv_write.hpp>
+# include <cmpad/csv_append.hpp>
+# include <cmpad/results_store.hpp>
+# include <cmpad/perf_counter.hpp>
 
 namespace {
    //
@@ -93,6 +171,26 @@ namespace {
       return "false";
    }
    //
+   // count2string
+   // a nan value is converted to the empty string
+   std::string count2string(double value)
+   {  if( std::isnan(value) )
+         return "";
+      std::stringstream ss;
+      ss << std::setprecision(0) << std::fixed << value;
+      return ss.str();
+   }
+   //
+   // double2string
+   // a nan value is converted to the empty string
+   std::string double2string(double value, int precision)
+   {  if( std::isnan(value) )
+         return "";
+      std::stringstream ss;
+      ss << std::setprecision(precision) << std::scientific << value;
+      return ss.str();
+   }
+   //
    // check_build_type
    void check_build_type(const std::string& package, const std::string& debug)
    {  // path
@@ -149,48 +247,21 @@ namespace cmpad { // BEGIN_CMPAD_NAMESPACE
 
 // BEGIN PROTOTYPE
 void csv_speed(
-   const std::string& file_name ,
-   double             rate      ,
-   double             min_time  ,
-   const std::string& package   ,
-   const std::string& algorithm ,
-   bool               special   ,
-   const option_t&    option    )
+   const std::string&    file_name ,
+   const speed_result_t& speed     ,
+   double                min_time  ,
+   const std::string&    package   ,
+   const std::string&    algorithm ,
+   bool                  special   ,
+   const option_t&       option    )
 // END PROTOTYPE
 {  //
-   // file_system
-   namespace filesystem = std::filesystem;
-   //
-   // csv_table
-   vec_vec_str csv_table;
-   //
-   // csv_table
-   filesystem::path path(file_name);
-   if( filesystem::exists( filesystem::path(file_name) ) )
-      csv_table = csv_read(file_name);
-   else
-   {  cmpad::vector<std::string> row = {
-         "rate",
-         "min_time",
-         "package",
-         "algorithm",
-         "n_arg",
-         "n_other",
-         "time_setup",
-         "date",
-         "compiler",
-         "debug",
-         "language",
-         "special"
-      };
-      csv_table.push_back(row);
-   }
    // ss
    std::stringstream ss;
    //
    // rate_str
    ss.str("");
-   ss << std::setprecision(1) << std::scientific << rate;
+   ss << std::setprecision(1) << std::scientific << speed.rate;
    std::string rate_str = ss.str();
    //
    // time_min_str
@@ -236,8 +307,67 @@ void csv_speed(
    else
       time_setup = "false";
    //
-   // csv_table
-   cmpad::vector<std::string> row = {
+   // n_warmup, n_sample, n_pool, n_outlier
+   std::string n_warmup, n_sample, n_pool, n_outlier;
+   if( speed.n_sample > 0 )
+   {  n_warmup  = std::to_string(speed.n_warmup);
+      n_sample  = std::to_string(speed.n_sample);
+      n_pool    = std::to_string(speed.n_pool);
+      n_outlier = std::to_string(speed.n_outlier);
+   }
+   //
+   // cpu
+   std::string cpu;
+   if( 0 <= speed.env.cpu )
+      cpu = std::to_string(speed.env.cpu);
+   //
+   // col_name
+   cmpad::vector<std::string> col_name = {
+      "rate",
+      "min_time",
+      "package",
+      "algorithm",
+      "n_arg",
+      "n_other",
+      "time_setup",
+      "date",
+      "compiler",
+      "debug",
+      "language",
+      "special",
+      "n_warmup",
+      "n_sample",
+      "n_pool",
+      "n_outlier",
+      "time_median",
+      "time_mad",
+      "time_min",
+      "time_lower",
+      "time_upper",
+      "time_init",
+      "break_even",
+      "n_op",
+      "n_var",
+      "tape_bytes",
+      "work_bytes",
+      "alloc_setup",
+      "byte_setup",
+      "alloc_eval",
+      "byte_eval",
+      "max_rss",
+      "clock",
+      "time_overhead",
+      "rel_error",
+      "ctx_switch",
+      "page_fault",
+      "cpu",
+      "governor",
+      "turbo",
+      "load_avg"
+   };
+   //
+   // col_value
+   cmpad::vector<std::string> col_value = {
       rate_str,
       min_time_str,
       package,
@@ -249,12 +379,182 @@ void csv_speed(
       compiler,
       debug,
       language,
-      bool2string(special)
+      bool2string(special),
+      n_warmup,
+      n_sample,
+      n_pool,
+      n_outlier,
+      double2string(speed.time_median, 3),
+      double2string(speed.time_mad, 3),
+      double2string(speed.time_min, 3),
+      double2string(speed.time_lower, 3),
+      double2string(speed.time_upper, 3),
+      double2string(speed.time_init, 3),
+      double2string(speed.break_even, 3),
+      count2string(speed.tape_stats.n_op),
+      count2string(speed.tape_stats.n_var),
+      count2string(speed.tape_stats.tape_bytes),
+      count2string(speed.tape_stats.work_bytes),
+      count2string(speed.alloc_setup),
+      count2string(speed.byte_setup),
+      double2string(speed.alloc_eval, 3),
+      double2string(speed.byte_eval, 3),
+      count2string(speed.max_rss),
+      speed.clock,
+      double2string(speed.time_overhead, 3),
+      double2string(speed.rel_error, 3),
+      count2string(speed.ctx_switch),
+      count2string(speed.page_fault),
+      cpu,
+      speed.env.governor,
+      speed.env.turbo,
+      double2string(speed.env.load_avg, 2)
    };
-   csv_table.push_back(row);
+   //
+   // col_name, col_value
+   // optional hardware performance counter columns
+   if( speed.perf_count.size() > 0 )
+   {  assert( speed.perf_count.size() == perf_counter::n_event );
+      for(size_t event = 0; event < perf_counter::n_event; ++event)
+      {  col_name.push_back( perf_counter::name(event) );
+         col_value.push_back( double2string(speed.perf_count[event], 3) );
+      }
+   }
+   //
+   // col_name, col_value
+   // optional setup phase columns
+   for(size_t i = 0; i < speed.setup_phase.size(); ++i)
+   {  col_name.push_back( "phase_" + speed.setup_phase[i].name );
+      col_value.push_back( double2string(speed.setup_phase[i].seconds, 3) );
+   }
+   //
+   // col_name, col_value
+   // optional latency columns
+   if( speed.latency.n_call() > 0 )
+   {  col_name.push_back( "latency_p50" );
+      col_value.push_back( double2string(speed.latency.percentile(50.0), 3) );
+      col_name.push_back( "latency_p90" );
+      col_value.push_back( double2string(speed.latency.percentile(90.0), 3) );
+      col_name.push_back( "latency_p99" );
+      col_value.push_back( double2string(speed.latency.percentile(99.0), 3) );
+      col_name.push_back( "latency_p999" );
+      col_value.push_back( double2string(speed.latency.percentile(99.9), 3) );
+      col_name.push_back( "latency_max" );
+      col_value.push_back( double2string(speed.latency.max(), 3) );
+   }
+   //
+   // col_name, col_value
+   // optional ratio columns
+   if( speed.ratio_base != "" )
+   {  col_name.push_back( "ratio_base" );
+      col_value.push_back( speed.ratio_base );
+      col_name.push_back( "ratio_median" );
+      col_value.push_back( double2string(speed.ratio_median, 3) );
+      col_name.push_back( "ratio_lower" );
+      col_value.push_back( double2string(speed.ratio_lower, 3) );
+      col_name.push_back( "ratio_upper" );
+      col_value.push_back( double2string(speed.ratio_upper, 3) );
+   }
+   //
+   // col_name, col_value
+   // optional static dispatch column
+   if( ! std::isnan( speed.static_ratio ) )
+   {  col_name.push_back( "static_ratio" );
+      col_value.push_back( double2string(speed.static_ratio, 3) );
+   }
+   //
+   // col_name, col_value
+   // optional gradient to function ratio column
+   if( ! std::isnan( speed.grad_ratio ) )
+   {  col_name.push_back( "grad_ratio" );
+      col_value.push_back( double2string(speed.grad_ratio, 3) );
+   }
+   //
+   // col_name, col_value
+   // optional floating point operation columns
+   if( ! std::isnan( speed.n_flop ) )
+   {  col_name.push_back( "n_flop" );
+      col_value.push_back( count2string(speed.n_flop) );
+   }
+   if( ! std::isnan( speed.gflops ) )
+   {  col_name.push_back( "gflops" );
+      col_value.push_back( double2string(speed.gflops, 3) );
+   }
+   if( ! std::isnan( speed.efficiency ) )
+   {  col_name.push_back( "efficiency" );
+      col_value.push_back( double2string(speed.efficiency, 3) );
+   }
+   //
+   // col_name, col_value
+   // optional cache columns
+   if( ! std::isnan( speed.cache_level ) )
+   {  col_name.push_back( "cache_level" );
+      col_value.push_back( count2string(speed.cache_level) );
+   }
+   if( speed.flush_cache )
+   {  col_name.push_back( "flush_cache" );
+      col_value.push_back( "true" );
+   }
+   //
+   // col_name, col_value
+   // optional raw sample column
+   if( speed.n_raw > 0 )
+   {  col_name.push_back( "n_raw" );
+      col_value.push_back( std::to_string(speed.n_raw) );
+   }
+   //
+   // n_store
+   // the time_sample column is not included in the results store
+   size_t n_store = col_name.size();
+   //
+   // col_name, col_value
+   // optional time sample column
+   if( speed.time_sample.size() > 1 )
+   {  ss.str("");
+      // all the digits, so cmpad_compare does not see artificial ties
+      ss << std::setprecision(17) << std::defaultfloat;
+      for(size_t i = 0; i < speed.time_sample.size(); ++i)
+      {  if( i > 0 )
+            ss << ' ';
+         ss << speed.time_sample[i];
+      }
+      col_name.push_back( "time_sample" );
+      col_value.push_back( ss.str() );
+   }
+   assert( col_name.size() == col_value.size() );
    //
    // file_name
-   csv_write(file_name, csv_table);
+   vec_vec_str row_vec = { col_value };
+   if( ! csv_append::rows(file_name, col_name, row_vec, true) )
+   {  std::cerr << "csv_speed: could not write to " << file_name << "\n";
+      std::exit(1);
+   }
+   //
+   // speed_dir
+   const std::string& speed_dir = results_store::speed_dir();
+   if( speed_dir != "" )
+   {  col_name.resize(n_store);
+      col_value.resize(n_store);
+      if( ! results_store::append(speed_dir, col_name, col_value) )
+      {  std::cerr << "csv_speed: could not write to " << speed_dir << "\n";
+         std::exit(1);
+      }
+   }
+}
+
+// BEGIN RATE PROTOTYPE
+void csv_speed(
+   const std::string& file_name ,
+   double             rate      ,
+   double             min_time  ,
+   const std::string& package   ,
+   const std::string& algorithm ,
+   bool               special   ,
+   const option_t&    option    )
+// END RATE PROTOTYPE
+{  speed_result_t speed;
+   speed.rate = rate;
+   csv_speed(file_name, speed, min_time, package, algorithm, special, option);
 }
 
 } // END_CMPAD_NAMESPACE
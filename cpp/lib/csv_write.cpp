@@ -14,9 +14,9 @@ Write a Csv File
 
 Prototype
 *********
-{xrst_literal
-   // BEGIN PROTOTYPE
-   // END PROTOTYPE
+{xrst_literal ,
+   // BEGIN PROTOTYPE, // END PROTOTYPE
+   // BEGIN CSV_FIELD, // END CSV_FIELD
 }
 
 vec_vec_str
@@ -28,7 +28,6 @@ file_name
 is the name of the csv file.
 The rows in this file are separated by newlines ``'\n'``
 and the columns are separated by commas ``','`` .
-There are no other special characters in this file.
 
 csv_table
 *********
@@ -37,6 +36,15 @@ csv_table
 #. 0 < csv_table[i].size() for all row indices *i* .
 #. The character ``','`` is added between columns.
 #. The character ``'\n'`` is added at the end of every line.
+#. Each value is written as *field* where
+   *field* = ``cmpad::csv_field`` ( *value* ) .
+
+csv_field
+*********
+If *value* contains a comma, newline, carriage return, or double quote,
+*field* is *value* surrounded by double quotes with each double quote
+in *value* doubled. Otherwise *field* is equal to *value* .
+This is the quoting in RFC 4180; see :ref:`csv_scan@Format` .
 
 {xrst_toc_hidden
    cpp/xam/csv_write.cpp
@@ -53,7 +61,8 @@ Example
 # include <fstream>
 # include <cassert>
 # include <iostream>
-# include <cmpad/vec_vec_str.hpp>
+# include <cmpad/csv_write.hpp>
+# include <cmpad/trace_event.hpp>
 
 namespace {
    // get_row
@@ -62,9 +71,9 @@ namespace {
       assert( 0 < row.size() );
       //
       // ofs
-      ofs << row[0];
+      ofs << cmpad::csv_field( row[0] );
       for(size_t j = 1; j < row.size(); ++j)
-         ofs << ',' << row[j];
+         ofs << ',' << cmpad::csv_field( row[j] );
       ofs << '\n';
       //
       return;
@@ -72,12 +81,30 @@ namespace {
 }
 
 namespace cmpad {
+   // BEGIN CSV_FIELD
+   std::string csv_field(const std::string& value)
+   // END CSV_FIELD
+   {  if( value.find_first_of(",\n\r\"") == std::string::npos )
+         return value;
+      std::string field = "\"";
+      for(size_t i = 0; i < value.size(); ++i)
+      {  if( value[i] == '"' )
+            field += '"';
+         field += value[i];
+      }
+      field += '"';
+      return field;
+   }
+   //
    // BEGIN PROTOTYPE
    void csv_write(
       const std::string& file_name ,
       const vec_vec_str& csv_table )
    // END PROTOTYPE
    {  //
+      // span
+      trace_event span("csv_write", "csv");
+      //
       // ofs
       std::ofstream ofs(file_name);
       if( ( ofs.rdstate() & std::ofstream::failbit ) != 0 )
@@ -0,0 +1,325 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin fun_compare}
+{xrst_spell
+   obj
+}
+
+Interleaved Comparison of Function Objects
+##########################################
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+Purpose
+*******
+When two function objects are timed by separate calls to
+:ref:`cpp_fun_speed-name` , changes in the processor frequency
+(e.g., due to turbo boost or temperature) between the calls bias
+the comparison.
+This routine times short slices for each of the function objects,
+in a random order, during each round.
+The ratio of the times for the same round are paired samples
+that are not sensitive to slow changes in the processor speed.
+
+fun_vec
+*******
+Each element of this vector is a pointer to a function object.
+The first element is the base for the ratios (see below).
+All of the function objects are setup using *option*
+before any of the timing is done.
+
+option
+******
+This is the :ref:`option_t-name` object used to setup the function objects.
+If *option*\ ``.time_setup`` is true, the setup is included in the
+time for each computation of a function object.
+
+min_time
+********
+This is the minimum time in seconds for the samples of each function object.
+
+speed_option
+************
+Only the following fields of this :ref:`speed_option_t-name`
+object are used:
+
+n_sample
+========
+is the number of rounds. During each round, a slice of computations
+is timed for each function object and the order of the function objects
+is a random permutation.
+(The permutations are the same each time this routine is called.)
+
+n_warmup
+========
+is the number of rounds that are done before the timed rounds.
+
+n_pool
+======
+is the number of argument vectors in the pool for each function object.
+
+clock
+=====
+is the :ref:`speed_clock-name` used for the timing.
+
+flush_cache
+===========
+If this is true, the caches are flushed before each computation of a
+function object and only the time for the computations is included in
+the samples; see :ref:`cpp_fun_speed@speed_option@Cold Caches` .
+
+Slice
+*****
+The number of computations in a slice, for each function object,
+is determined by doubling it until one slice takes at least
+*min_time* divided by *n_sample* seconds
+(including the time for flushing the caches).
+As with :ref:`cpp_fun_speed-name` , the overhead for the clock and the loop
+is subtracted from the time for each slice.
+
+speed
+*****
+The return value *speed* has the same size as *fun_vec* and
+*speed* [ *k* ] is the :ref:`speed_result_t-name` for
+*fun_vec* [ *k* ] .
+Each of its samples is the seconds for one computation during one round
+and the statistics are computed using :ref:`speed_stat-name` .
+Its :ref:`speed_result_t@time_init` is the time for the first setup.
+
+Ratio
+=====
+For each round, the ratio of the seconds for one computation of
+*fun_vec* [ *k* ] divided by the seconds for *fun_vec* [0]
+is a paired sample.
+The median, and the limits of the 95 percent confidence interval,
+for these samples are computed in the same way as by :ref:`speed_stat-name`
+and are returned in the fields
+:ref:`speed_result_t@ratio_median` ,
+:ref:`speed_result_t@ratio_lower` ,
+:ref:`speed_result_t@ratio_upper` .
+A ratio less than one means that *fun_vec* [ *k* ] is faster than
+*fun_vec* [0] .
+The :ref:`speed_result_t@ratio_base` field is not set by this routine.
+
+Trace Events
+************
+If :ref:`trace_event@Enabled` is true,
+the setup and each slice are recorded as :ref:`trace_event-name` spans
+with category ``fun_compare`` .
+The *fun* argument for a span is the index *k* in *fun_vec* .
+
+{xrst_toc_hidden
+   cpp/xam/fun_compare.cpp
+}
+Example
+*******
+:ref:`xam_fun_compare.cpp-name` contains an example and test of this routine.
+
+{xrst_end fun_compare}
+------------------------------------------------------------------------------
+*/
+# include <iostream>
+# include <algorithm>
+# include <random>
+# include <cmpad/cache_info.hpp>
+# include <cmpad/fun_compare.hpp>
+# include <cmpad/speed_clock.hpp>
+# include <cmpad/speed_stat.hpp>
+# include <cmpad/trace_event.hpp>
+# include <cmpad/uniform_01.hpp>
+
+namespace cmpad {
+
+// BEGIN PROTOTYPE
+cmpad::vector<speed_result_t> fun_compare(
+   const cmpad::vector< fun_obj< cmpad::vector<double> >* >& fun_vec ,
+   const option_t&                                          option  ,
+   double                                                   min_time,
+   const speed_option_t&                                    speed_option )
+// END PROTOTYPE
+{  //
+   // clock
+   speed_clock clock( speed_option.clock );
+   //
+   // n_fun, n_sample, n_warmup, n_pool
+   size_t n_fun    = fun_vec.size();
+   size_t n_sample = speed_option.n_sample;
+   size_t n_warmup = speed_option.n_warmup;
+   size_t n_pool   = speed_option.n_pool;
+   if( n_fun == 0 )
+   {  std::cerr << "cmpad::fun_compare: fun_vec is empty\n";
+      std::exit(1);
+   }
+   if( n_sample == 0 )
+   {  std::cerr << "cmpad::fun_compare: speed_option.n_sample is zero\n";
+      std::exit(1);
+   }
+   if( n_pool == 0 )
+   {  std::cerr << "cmpad::fun_compare: speed_option.n_pool is zero\n";
+      std::exit(1);
+   }
+   //
+   // flush
+   // the flush buffer is allocated here, before any timing
+   bool flush = speed_option.flush_cache;
+   if( flush )
+      flush_cache();
+   //
+   // speed
+   cmpad::vector<speed_result_t> speed(n_fun);
+   for(size_t k = 0; k < n_fun; ++k)
+   {  speed[k].n_warmup    = n_warmup;
+      speed[k].n_sample    = n_sample;
+      speed[k].n_pool      = n_pool;
+      speed[k].clock       = clock.name();
+      speed[k].flush_cache = flush;
+      speed[k].time_sample.resize(n_sample);
+   }
+   //
+   // speed[k].time_init
+   for(size_t k = 0; k < n_fun; ++k)
+   {  trace_event span("setup", "fun_compare");
+      uint64_t t_init = clock.tick();
+      fun_vec[k]->setup(option);
+      speed[k].time_init = clock.seconds( clock.tick() - t_init );
+      span.arg("fun", double(k) );
+   }
+   //
+   // pool, i_pool
+   cmpad::vector< cmpad::vector< cmpad::vector<double> > > pool(n_fun);
+   cmpad::vector<size_t> i_pool(n_fun);
+   for(size_t k = 0; k < n_fun; ++k)
+   {  size_t n = fun_vec[k]->domain();
+      pool[k].resize(n_pool);
+      for(size_t j = 0; j < n_pool; ++j)
+      {  pool[k][j].resize(n);
+         uniform_01( pool[k][j] );
+      }
+      i_pool[k] = 0;
+   }
+   //
+   // t_wall
+   // wall clock seconds for the most recent call to time_pass
+   double t_wall = 0.0;
+   //
+   // time_pass
+   // time in seconds to compute fun_vec[k] repeat times
+   // (when flushing, the time for the flushes is not included)
+   auto time_pass = [&](size_t k, size_t repeat)
+   {  fun_obj< cmpad::vector<double> >& fun_k = *fun_vec[k];
+      uint64_t t_start = clock.tick();
+      uint64_t n_tick  = 0;
+      for(size_t i = 0; i < repeat; ++i)
+      {  const cmpad::vector<double>& x = pool[k][ i_pool[k] ];
+         if( ++i_pool[k] == n_pool )
+            i_pool[k] = 0;
+         if( flush )
+         {  flush_cache();
+            uint64_t t_call = clock.tick();
+            if( option.time_setup )
+               fun_k.setup(option);
+            fun_k(x);
+            n_tick += clock.tick() - t_call;
+         }
+         else
+         {  if( option.time_setup )
+               fun_k.setup(option);
+            fun_k(x);
+         }
+      }
+      uint64_t t_end = clock.tick();
+      t_wall         = clock.seconds(t_end - t_start);
+      if( flush )
+         return clock.seconds(n_tick);
+      return t_wall;
+   };
+   //
+   // empty_pass
+   // time in seconds for a pass that does not compute fun_vec[k]
+   auto empty_pass = [&](size_t k, size_t repeat)
+   {  return clock.empty_pass(pool[k], i_pool[k], repeat, flush); };
+   //
+   // repeat, t_overhead, speed[k].time_overhead
+   double slice_time = min_time / double(n_sample);
+   cmpad::vector<size_t> repeat(n_fun);
+   cmpad::vector<double> t_overhead(n_fun);
+   for(size_t k = 0; k < n_fun; ++k)
+   {  trace_event span("calibrate", "fun_compare");
+      span.arg("fun", double(k) );
+      repeat[k] = 1;
+      time_pass(k, repeat[k]);
+      while( t_wall < slice_time )
+      {  if( 2 * repeat[k] <= repeat[k] )
+         {  std::cerr << "cmpad::fun_compare: 2 * repeat <= repeat\n";
+            std::exit(1);
+         }
+         repeat[k] = 2 * repeat[k];
+         time_pass(k, repeat[k]);
+      }
+      t_overhead[k] = empty_pass(k, repeat[k]);
+      for(size_t i = 0; i < 4; ++i)
+         t_overhead[k] = std::min(t_overhead[k], empty_pass(k, repeat[k]) );
+      speed[k].time_overhead = t_overhead[k] / double(repeat[k]);
+   }
+   //
+   // order, generator
+   // the seed is fixed so that the permutations are reproducible
+   cmpad::vector<size_t> order(n_fun);
+   for(size_t k = 0; k < n_fun; ++k)
+      order[k] = k;
+   std::mt19937 generator(0);
+   //
+   // speed[k].time_sample
+   for(size_t round = 0; round < n_warmup + n_sample; ++round)
+   {  std::shuffle(order.begin(), order.end(), generator);
+      for(size_t j = 0; j < n_fun; ++j)
+      {  size_t k      = order[j];
+         trace_event span("slice", "fun_compare");
+         double t_pass = time_pass(k, repeat[k]);
+         span.arg("fun",    double(k) );
+         span.arg("repeat", double(repeat[k]) );
+         if( n_warmup <= round )
+         {  // the overhead is not subtracted if that would not leave
+            // a positive time
+            double t_net = t_pass - t_overhead[k];
+            if( t_net <= 0.0 )
+            {  t_net = t_pass;
+               ++speed[k].n_raw;
+            }
+            speed[k].time_sample[round - n_warmup] = t_net / double(repeat[k]);
+         }
+      }
+   }
+   //
+   // speed
+   for(size_t k = 0; k < n_fun; ++k)
+      speed_stat( speed[k] );
+   //
+   // speed[k].ratio_median, speed[k].ratio_lower, speed[k].ratio_upper
+   for(size_t k = 0; k < n_fun; ++k)
+   {  speed_result_t ratio;
+      for(size_t r = 0; r < n_sample; ++r)
+      {  double base = speed[0].time_sample[r];
+         if( 0.0 < base )
+            ratio.time_sample.push_back( speed[k].time_sample[r] / base );
+      }
+      if( ratio.time_sample.size() > 0 )
+      {  speed_stat(ratio);
+         speed[k].ratio_median = ratio.time_median;
+         speed[k].ratio_lower  = ratio.time_lower;
+         speed[k].ratio_upper  = ratio.time_upper;
+      }
+   }
+   //
+   return speed;
+}
+
+} // END cmpad namespace
@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin jit_lib}
+{xrst_spell
+   dir
+   dlopen
+   elf
+   jit
+   perf
+   pid
+   symtab
+}
+
+Libraries Created by Just In Time Compilation
+#############################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/jit_lib.hpp>``
+| |tab| *dir* = ``cmpad::jit_lib::new_dir`` ( *package* )
+| |tab| ``cmpad::jit_lib::release_dir`` ( *dir* )
+| |tab| ``cmpad::jit_lib::enable_perf_map`` ( *on* )
+| |tab| *on* = ``cmpad::jit_lib::perf_map_enabled`` ()
+| |tab| *n_symbol* = ``cmpad::jit_lib::perf_map`` ( *dir* )
+
+Purpose
+*******
+The cppad_jit and cppadcg gradient setup routines generate C source code,
+compile it to a dynamic library, and load the library using ``dlopen`` .
+If the library was overwritten after it was loaded,
+a profiler such as ``perf`` cannot attribute the time spent in the
+generated code.
+These routines give each function object a unique directory
+for its library
+and, optionally, record the generated functions in a ``perf`` map file.
+
+new_dir
+*******
+This routine creates a new directory with the path
+
+   *temp* ``/cmpad_jit/`` *package* ``-`` *pid* ``-`` *index*
+
+where *temp* is the C++ temporary directory,
+*pid* is the process id, and *index* is the first non-negative integer
+for which the directory did not already exist.
+The ``std::filesystem::path`` return value *dir* is its path.
+A function object calls this routine during its first setup
+and uses the same directory for the libraries created by later setups
+(after closing the previous library).
+Thus there is at most one directory for each function object,
+and there is no directory creation or removal during a setup
+that is timed; see :ref:`option_t@time_setup` .
+
+package
+=======
+This ``std::string`` is the name of the package that uses the directory;
+e.g., ``cppad_jit`` .
+
+release_dir
+***********
+This routine is called when the function object that uses *dir*
+is destroyed (after its library has been closed).
+
+#. If the perf map is enabled (see *on* below),
+   *dir* and the library in it are not removed
+   so that a profiler can use them after the program has finished.
+   You can remove the *temp*\ ``/cmpad_jit`` directory when it is no longer
+   needed.
+#. Otherwise, *dir* is removed.
+   If *dir* cannot be removed now, it is removed when the program exits.
+
+Thus a sequence of runs that does not use the perf map does not leave
+directories in *temp* .
+
+Perf Map
+********
+
+on
+==
+This ``bool`` is true if the perf map file is enabled
+(the initial value is false).
+
+perf_map
+========
+If *on* is true, this routine appends a line to the file
+
+   ``/tmp/perf-``\ *pid*\ ``.map``
+
+for each function in each of the libraries that are currently loaded
+from the directory *dir* .
+The line has the format (used by ``perf report`` )
+
+   *start* *size* *name*
+
+where *start* is the address of the function, *size* is its
+size in bytes (both in hexadecimal), and *name* is its name.
+The function names are read from the ELF ``symtab`` section of the library
+(from the dynamic symbols if the library has been stripped).
+The ``size_t`` return value *n_symbol* is the number of lines
+that were added to the file.
+If *on* is false, or this is not a Linux system, nothing is done
+and *n_symbol* is zero.
+
+Attribution
+===========
+``perf report`` only uses the map file for addresses that are not in a
+file backed mapping (e.g., code generated in anonymous memory).
+A library loaded with ``dlopen`` is a file backed mapping,
+so ``perf`` ignores the map file entries for it and instead reads the
+symbols from the library file named in its recorded ``mmap`` event.
+Hence it is keeping the library, and its directory, that makes it possible
+to attribute samples to the generated functions; the map file entries are
+for tools that only read the map file.
+A later setup of the same function object replaces the library,
+so the samples are attributed using the last library
+(which has the same functions when the setup options are the same).
+
+{xrst_toc_hidden
+   cpp/xam/jit_lib.cpp
+}
+Example
+*******
+:ref:`xam_jit_lib.cpp-name` contains an example and test of
+these routines.
+
+{xrst_end jit_lib}
+------------------------------------------------------------------------------
+*/
+# include <cstdint>
+# include <fstream>
+# include <sstream>
+# include <iterator>
+# include <vector>
+# include <cmpad/jit_lib.hpp>
+
+# ifdef __linux__
+# include <unistd.h>
+# include <link.h>
+# include <elf.h>
+# endif
+
+namespace {
+   // perf_map_on_
+   bool perf_map_on_ = false;
+   //
+   // exit_remove_t
+   // directories that are removed when the program exits
+   class exit_remove_t {
+   public:
+      std::vector<std::filesystem::path> dir_vec;
+      ~exit_remove_t(void)
+      {  std::error_code ec;
+         for(const std::filesystem::path& dir : dir_vec)
+            std::filesystem::remove_all(dir, ec);
+      }
+   };
+   exit_remove_t exit_remove_;
+# ifdef __linux__
+   //
+   // loaded_t
+   struct loaded_t {
+      std::string name;
+      uintptr_t   base;
+   };
+   //
+   // add_loaded
+   // callback for dl_iterate_phdr
+   int add_loaded(struct dl_phdr_info* info, size_t, void* data)
+   {  std::vector<loaded_t>* loaded_vec =
+         reinterpret_cast< std::vector<loaded_t>* >(data);
+      if( info->dlpi_name != nullptr && info->dlpi_name[0] != '\0' )
+         loaded_vec->push_back( { info->dlpi_name, info->dlpi_addr } );
+      return 0;
+   }
+   //
+   // write_symbols
+   // write the functions in a loaded library to os, return number written
+   size_t write_symbols(
+      std::ostream& os, const std::string& file_name, uintptr_t base
+   )
+   {  //
+      // data
+      std::ifstream file(file_name, std::ios::binary);
+      std::vector<char> data(
+         (std::istreambuf_iterator<char>(file)),
+         std::istreambuf_iterator<char>()
+      );
+      //
+      // ehdr
+      if( data.size() < sizeof(ElfW(Ehdr)) )
+         return 0;
+      const ElfW(Ehdr)* ehdr = reinterpret_cast<const ElfW(Ehdr)*>(
+         data.data()
+      );
+      if( std::string(
+         reinterpret_cast<const char*>(ehdr->e_ident), SELFMAG
+      ) != ELFMAG )
+         return 0;
+      size_t n_section = ehdr->e_shnum;
+      if( data.size() < ehdr->e_shoff + n_section * sizeof(ElfW(Shdr)) )
+         return 0;
+      const ElfW(Shdr)* shdr = reinterpret_cast<const ElfW(Shdr)*>(
+         data.data() + ehdr->e_shoff
+      );
+      //
+      // i_symbol
+      // index of the symtab section, or the dynsym section if no symtab
+      size_t i_symbol = n_section;
+      for(size_t i = 0; i < n_section; ++i)
+      {  if( shdr[i].sh_type == SHT_SYMTAB )
+            i_symbol = i;
+         if( shdr[i].sh_type == SHT_DYNSYM && i_symbol == n_section )
+            i_symbol = i;
+      }
+      if( i_symbol == n_section || n_section <= shdr[i_symbol].sh_link )
+         return 0;
+      //
+      // symbol, n_symbol, name_table
+      const ElfW(Shdr)& symbol_section = shdr[i_symbol];
+      const ElfW(Shdr)& string_section = shdr[ symbol_section.sh_link ];
+      if( data.size() < symbol_section.sh_offset + symbol_section.sh_size )
+         return 0;
+      if( data.size() < string_section.sh_offset + string_section.sh_size )
+         return 0;
+      const ElfW(Sym)* symbol = reinterpret_cast<const ElfW(Sym)*>(
+         data.data() + symbol_section.sh_offset
+      );
+      size_t      n_symbol = symbol_section.sh_size / sizeof(ElfW(Sym));
+      const char* name_table = data.data() + string_section.sh_offset;
+      //
+      // os
+      size_t n_write = 0;
+      os << std::hex;
+      for(size_t i = 0; i < n_symbol; ++i)
+      {  bool function = (symbol[i].st_info & 0xf) == STT_FUNC;
+         bool defined  = symbol[i].st_shndx != SHN_UNDEF;
+         bool in_range = symbol[i].st_name < string_section.sh_size;
+         if( function && defined && in_range && 0 < symbol[i].st_size )
+         {  os << base + symbol[i].st_value << " "
+               << symbol[i].st_size << " "
+               << name_table + symbol[i].st_name << "\n";
+            ++n_write;
+         }
+      }
+      os << std::dec;
+      return n_write;
+   }
+# endif
+}
+
+namespace cmpad {
+   //
+   // new_dir
+   std::filesystem::path jit_lib::new_dir(const std::string& package)
+   {  namespace filesystem = std::filesystem;
+      //
+      // pid
+      std::string pid = "0";
+# ifdef __linux__
+      pid = std::to_string( getpid() );
+# endif
+      //
+      // parent
+      filesystem::path parent = filesystem::temp_directory_path();
+      parent /= "cmpad_jit";
+      filesystem::create_directories(parent);
+      //
+      // dir
+      for(size_t index = 0; ; ++index)
+      {  filesystem::path dir = parent;
+         dir /= package + "-" + pid + "-" + std::to_string(index);
+         if( filesystem::create_directory(dir) )
+            return dir;
+      }
+   }
+   //
+   // release_dir
+   void jit_lib::release_dir(const std::filesystem::path& dir)
+   {  if( perf_map_on_ )
+         return;
+      std::error_code ec;
+      std::filesystem::remove_all(dir, ec);
+      if( ec )
+         exit_remove_.dir_vec.push_back(dir);
+   }
+   //
+   // enable_perf_map
+   void jit_lib::enable_perf_map(bool on)
+   {  perf_map_on_ = on; }
+   //
+   // perf_map_enabled
+   bool jit_lib::perf_map_enabled(void)
+   {  return perf_map_on_; }
+   //
+   // perf_map
+   size_t jit_lib::perf_map(const std::filesystem::path& dir)
+   {  size_t n_symbol = 0;
+# ifdef __linux__
+      namespace filesystem = std::filesystem;
+      if( ! perf_map_on_ )
+         return 0;
+      //
+      // loaded_vec
+      std::vector<loaded_t> loaded_vec;
+      dl_iterate_phdr(add_loaded, &loaded_vec);
+      //
+      // map_file
+      std::string map_file = "/tmp/perf-" + std::to_string( getpid() ) + ".map";
+      std::ofstream map_stream(map_file, std::ios::app);
+      //
+      // n_symbol
+      // (a library loaded using a relative path is relative to the
+      // current working directory)
+      std::error_code  ec;
+      filesystem::path dir_path = filesystem::weakly_canonical(dir, ec);
+      std::string      prefix   = dir_path.string() + "/";
+      for(const loaded_t& loaded : loaded_vec)
+      {  filesystem::path lib_path =
+            filesystem::weakly_canonical(loaded.name, ec);
+         std::string lib_file = lib_path.string();
+         if( lib_file.compare(0, prefix.size(), prefix) == 0 )
+            n_symbol += write_symbols(map_stream, lib_file, loaded.base);
+      }
+# endif
+      return n_symbol;
+   }
+}
@@ -0,0 +1,319 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin mann_whitney}
+{xrst_spell
+   hodges
+   lehmann
+   mann
+   struct
+   whitney
+}
+
+Compare Two Sets of Timing Samples
+##################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/mann_whitney.hpp>``
+| |tab| *result* = ``cmpad::mann_whitney`` ( *baseline* , *candidate* , *alpha* )
+
+Purpose
+*******
+This routine tests if the timing samples for a candidate version of
+a function object come from the same distribution as the samples for a
+baseline version, and estimates the speedup of the candidate.
+It does not assume that the samples are normally distributed.
+
+baseline
+********
+This ``const cmpad::vector<double>&`` contains the seconds for each
+computation for the baseline version. It must have at least one element
+and all its elements must be positive.
+
+candidate
+*********
+This ``const cmpad::vector<double>&`` contains the seconds for each
+computation for the candidate version. It must have at least one element
+and all its elements must be positive.
+
+alpha
+*****
+This ``double`` is between zero and one and
+the confidence level for the speedup interval is 1 - *alpha* ;
+e.g., 0.05 for a 95% interval.
+
+result
+******
+The return value has the following type:
+{xrst_literal
+   cpp/include/cmpad/mann_whitney.hpp
+   // BEGIN MANN_WHITNEY_T
+   // END MANN_WHITNEY_T
+}
+
+u
+=
+This is the Mann-Whitney U statistic for *baseline* ; i.e.,
+the number of pairs where the baseline sample is greater than the candidate
+sample (pairs that are equal count one half).
+
+p_value
+=======
+This is the two-sided p-value for the hypothesis that the two sets of
+samples have the same distribution.
+It uses the normal approximation for *u* with a correction for ties
+and a continuity correction.
+If it is less than *alpha* , the difference between the baseline and
+candidate is significant.
+If all the samples are equal, *p_value* is one.
+
+speedup
+=======
+This is the baseline time divided by the candidate time; i.e.,
+greater than one means the candidate is faster.
+It is the Hodges-Lehmann estimate; i.e.,
+the exponential of the median of the differences
+log( *baseline* [ *i* ] ) - log( *candidate* [ *j* ] )
+for all pairs *i* , *j* .
+
+speedup_lower, speedup_upper
+============================
+This is a 1 - *alpha* confidence interval for *speedup*
+using the order statistics of the differences above.
+If there are too few samples for this confidence level, it is the interval
+between the minimum and maximum difference.
+
+Memory
+******
+The differences above are not stored.
+The order statistics are selected by bisection on the value of the
+difference, counting the pairs below a value in
+O( *n1* + *n2* ) operations (where *n1* and *n2* are the number of
+baseline and candidate samples).
+Hence the memory used is O( *n1* + *n2* ) even when the number of pairs
+*n1* * *n2* is very large.
+
+{xrst_toc_hidden
+   cpp/xam/mann_whitney.cpp
+}
+Example
+*******
+:ref:`xam_mann_whitney.cpp-name` contains an example and test of this routine.
+
+{xrst_end mann_whitney}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cassert>
+# include <cstddef>
+# include <algorithm>
+# include <vector>
+# include <cmpad/mann_whitney.hpp>
+
+namespace {
+   // normal_cdf
+   double normal_cdf(double z)
+   {  return 0.5 * std::erfc( - z / std::sqrt(2.0) ); }
+   //
+   // normal_quantile
+   // solve normal_cdf(z) = probability using bisection
+   double normal_quantile(double probability)
+   {  double lower = -40.0;
+      double upper = +40.0;
+      for(size_t i = 0; i < 100; ++i)
+      {  double mid = (lower + upper) / 2.0;
+         if( normal_cdf(mid) < probability )
+            lower = mid;
+         else
+            upper = mid;
+      }
+      return (lower + upper) / 2.0;
+   }
+   //
+   // count_less_equal
+   // number of pairs ( i , j ) with x[i] - y[j] <= value
+   // (x and y are sorted in increasing order)
+   size_t count_less_equal(
+      const std::vector<double>& x     ,
+      const std::vector<double>& y     ,
+      double                     value )
+   {  size_t n1    = x.size();
+      size_t n2    = y.size();
+      size_t count = 0;
+      size_t j     = 0;
+      for(size_t i = 0; i < n1; ++i)
+      {  // x[i] - y[j] is increasing in i and decreasing in j
+         while( j < n2 && x[i] - y[j] > value )
+            ++j;
+         count += n2 - j;
+      }
+      return count;
+   }
+   //
+   // order_difference
+   // the k-th (zero based) smallest of x[i] - y[j] for all pairs ( i , j )
+   // (x and y are sorted in increasing order)
+   double order_difference(
+      const std::vector<double>& x ,
+      const std::vector<double>& y ,
+      size_t                     k )
+   {  size_t n1 = x.size();
+      size_t n2 = y.size();
+      assert( k < n1 * n2 );
+      //
+      // lower, upper
+      // count_less_equal(lower) <= k < count_less_equal(upper)
+      double lower = x[0] - y[n2 - 1];
+      double upper = x[n1 - 1] - y[0];
+      size_t count_lower = count_less_equal(x, y, lower);
+      if( k < count_lower )
+         return lower;
+      size_t count_upper = n1 * n2;
+      //
+      // lower, upper
+      // bisection until there are few pairs in the interval (lower, upper]
+      size_t n_keep = std::max( n1 + n2, size_t(1024) );
+      while( count_upper - count_lower > n_keep )
+      {  double middle = lower + (upper - lower) / 2.0;
+         if( middle <= lower || upper <= middle )
+         {  // there is no double between lower and upper
+            return upper;
+         }
+         size_t count_middle = count_less_equal(x, y, middle);
+         if( k < count_middle )
+         {  upper       = middle;
+            count_upper = count_middle;
+         }
+         else
+         {  lower       = middle;
+            count_lower = count_middle;
+         }
+      }
+      //
+      // between
+      // the differences in the interval (lower, upper]
+      std::vector<double> between;
+      between.reserve(count_upper - count_lower);
+      size_t j_begin = 0;
+      size_t j_end   = 0;
+      for(size_t i = 0; i < n1; ++i)
+      {  // j_end:   first j with x[i] - y[j] <= upper
+         // j_begin: first j with x[i] - y[j] <= lower
+         while( j_end < n2 && x[i] - y[j_end] > upper )
+            ++j_end;
+         while( j_begin < n2 && x[i] - y[j_begin] > lower )
+            ++j_begin;
+         for(size_t j = j_end; j < j_begin; ++j)
+            between.push_back( x[i] - y[j] );
+      }
+      assert( between.size() == count_upper - count_lower );
+      //
+      // k-th difference
+      size_t index = k - count_lower;
+      std::nth_element(
+         between.begin(), between.begin() + std::ptrdiff_t(index), between.end()
+      );
+      return between[index];
+   }
+}
+
+namespace cmpad {
+   mann_whitney_t mann_whitney(
+      const cmpad::vector<double>& baseline  ,
+      const cmpad::vector<double>& candidate ,
+      double                       alpha     )
+   {  //
+      // n1, n2, n
+      size_t n1 = baseline.size();
+      size_t n2 = candidate.size();
+      size_t n  = n1 + n2;
+      assert( 0 < n1 && 0 < n2 );
+      assert( 0.0 < alpha && alpha < 1.0 );
+      //
+      // sample
+      // (time, true if baseline) sorted by time
+      std::vector< std::pair<double, bool> > sample(n);
+      for(size_t i = 0; i < n1; ++i)
+         sample[i] = { baseline[i], true };
+      for(size_t j = 0; j < n2; ++j)
+         sample[n1 + j] = { candidate[j], false };
+      std::sort(sample.begin(), sample.end());
+      //
+      // rank_sum, tie_sum
+      // sum of the one based ranks of the baseline samples
+      // and sum of t^3 - t for each group of t equal samples
+      double rank_sum = 0.0;
+      double tie_sum  = 0.0;
+      size_t start    = 0;
+      while( start < n )
+      {  size_t end = start + 1;
+         while( end < n && sample[end].first == sample[start].first )
+            ++end;
+         double t    = double(end - start);
+         double rank = double(start + 1 + end) / 2.0;
+         for(size_t k = start; k < end; ++k)
+         {  if( sample[k].second )
+               rank_sum += rank;
+         }
+         tie_sum += t * t * t - t;
+         start    = end;
+      }
+      //
+      // result.u
+      mann_whitney_t result;
+      double m1 = double(n1);
+      double m2 = double(n2);
+      double m  = double(n);
+      result.u  = rank_sum - m1 * (m1 + 1.0) / 2.0;
+      //
+      // result.p_value
+      double mean     = m1 * m2 / 2.0;
+      double variance = m1 * m2 / 12.0;
+      if( n > 1 )
+         variance *= (m + 1.0) - tie_sum / (m * (m - 1.0));
+      if( variance <= 0.0 )
+         result.p_value = 1.0;
+      else
+      {  double distance = std::max( std::fabs(result.u - mean) - 0.5, 0.0 );
+         double z        = distance / std::sqrt(variance);
+         result.p_value  = std::min( 2.0 * normal_cdf(-z), 1.0 );
+      }
+      //
+      // log_base, log_cand
+      // the differences are log_base[i] - log_cand[j] for all pairs
+      std::vector<double> log_base(n1), log_cand(n2);
+      for(size_t i = 0; i < n1; ++i)
+         log_base[i] = std::log( baseline[i] );
+      for(size_t j = 0; j < n2; ++j)
+         log_cand[j] = std::log( candidate[j] );
+      std::sort(log_base.begin(), log_base.end());
+      std::sort(log_cand.begin(), log_cand.end());
+      //
+      // result.speedup
+      size_t n_pair = n1 * n2;
+      double median = order_difference(log_base, log_cand, n_pair / 2);
+      if( n_pair % 2 == 0 )
+      {  double below = order_difference(log_base, log_cand, n_pair / 2 - 1);
+         median       = (below + median) / 2.0;
+      }
+      result.speedup = std::exp(median);
+      //
+      // result.speedup_lower, result.speedup_upper
+      // zero based index of the lower order statistic
+      double z     = normal_quantile(1.0 - alpha / 2.0);
+      double half  = z * std::sqrt( m1 * m2 * (m + 1.0) / 12.0 );
+      double index = std::floor( m1 * m2 / 2.0 - half );
+      size_t lower = 0;
+      if( 0.0 < index )
+         lower = std::min( size_t(index), (n_pair - 1) / 2 );
+      result.speedup_lower =
+         std::exp( order_difference(log_base, log_cand, lower) );
+      result.speedup_upper =
+         std::exp( order_difference(log_base, log_cand, n_pair - 1 - lower) );
+      //
+      return result;
+   }
+}
@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin perf_counter}
+{xrst_spell
+   dtlb
+   ioctl
+   llc
+   nan
+   paranoid
+   proc
+   sys
+}
+
+Hardware Performance Counters
+#############################
+
+Syntax
+******
+| |tab| ``# include <cmpad/perf_counter.hpp>``
+| |tab| ``cmpad::perf_counter`` *counter*
+| |tab| *n_open* = *counter* . ``open`` ()
+| |tab| *counter* . ``start`` ()
+| |tab| *counter* . ``stop`` ()
+| |tab| *counter* . ``reset`` ()
+| |tab| *value* = *counter* . ``count`` ( *event* )
+| |tab| *name* = ``cmpad::perf_counter::name`` ( *event* )
+
+Purpose
+*******
+This class uses the Linux ``perf_event_open`` system call to count
+hardware events for the current thread; e.g., how many instructions
+and cache misses a computation requires.
+Only events in user space are counted.
+On other systems, and when the kernel denies access to the counters,
+the counts are not available; see *n_open* below.
+
+event
+*****
+The following table lists the possible values for *event*
+and the corresponding *name* :
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   event, name, meaning
+   cycles,       ``cycles``,       CPU cycles
+   instructions, ``instructions``, instructions retired
+   l1d_miss,     ``l1d_miss``,     level one data cache read misses
+   llc_miss,     ``llc_miss``,     last level cache read misses
+   branch_miss,  ``branch_miss``,  mis-predicted branches
+   dtlb_miss,    ``dtlb_miss``,    data translation look aside buffer misses
+
+The value ``cmpad::perf_counter::n_event`` is the number of events.
+
+counter
+*******
+The constructor does not open any counters.
+A ``perf_counter`` cannot be copied.
+The destructor closes the counters that are open.
+
+n_open
+******
+The ``open`` routine attempts to open a counter for each event and
+returns the number of events that were successfully opened.
+It is zero when the kernel denies access to the counters; e.g.,
+when ``/proc/sys/kernel/perf_event_paranoid`` is greater than two.
+
+start
+*****
+The ``start`` routine enables counting for the events that are open.
+
+stop
+****
+The ``stop`` routine disables counting for the events that are open.
+
+reset
+*****
+The ``reset`` routine sets the count for each event to zero.
+
+value
+*****
+This is the number of events that have occurred while counting was
+enabled (since the last reset).
+If the hardware had to multiplex the counters,
+the count is scaled by the fraction of time the counter was running.
+If *event* is not open, *value* is ``nan`` .
+If counting was enabled but the counter never ran
+(because other events used all the hardware counters),
+*value* is ``nan`` (not zero).
+
+{xrst_toc_hidden
+   cpp/xam/perf_counter.cpp
+}
+Example
+*******
+:ref:`xam_perf_counter.cpp-name` contains an example and test of this class.
+
+{xrst_end perf_counter}
+------------------------------------------------------------------------------
+*/
+# include <cassert>
+# include <limits>
+# include <cmpad/perf_counter.hpp>
+
+# ifdef __linux__
+# include <unistd.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+# endif
+
+namespace {
+# ifdef __linux__
+   // open_event
+   int open_event(size_t event)
+   {  //
+      // type, config
+      uint32_t type   = PERF_TYPE_HARDWARE;
+      uint64_t config = 0;
+      uint64_t read_miss =
+         (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      switch( event )
+      {  case cmpad::perf_counter::cycles:
+         config = PERF_COUNT_HW_CPU_CYCLES;
+         break;
+         //
+         case cmpad::perf_counter::instructions:
+         config = PERF_COUNT_HW_INSTRUCTIONS;
+         break;
+         //
+         case cmpad::perf_counter::l1d_miss:
+         type   = PERF_TYPE_HW_CACHE;
+         config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+         break;
+         //
+         case cmpad::perf_counter::llc_miss:
+         type   = PERF_TYPE_HW_CACHE;
+         config = PERF_COUNT_HW_CACHE_LL | read_miss;
+         break;
+         //
+         case cmpad::perf_counter::branch_miss:
+         config = PERF_COUNT_HW_BRANCH_MISSES;
+         break;
+         //
+         case cmpad::perf_counter::dtlb_miss:
+         type   = PERF_TYPE_HW_CACHE;
+         config = PERF_COUNT_HW_CACHE_DTLB | read_miss;
+         break;
+         //
+         default:
+         assert(false);
+         return -1;
+      }
+      //
+      // attr
+      struct perf_event_attr attr = {};
+      attr.size           = sizeof(attr);
+      attr.type           = type;
+      attr.config         = config;
+      attr.disabled       = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv     = 1;
+      attr.read_format    =
+         PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      //
+      // fd
+      // this thread, any cpu, no group, no flags
+      long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+      return int(fd);
+   }
+   //
+   // read_event
+   bool read_event(
+      int fd, uint64_t& value, uint64_t& enabled, uint64_t& running
+   )
+   {  uint64_t data[3];
+      if( read(fd, data, sizeof(data)) != ssize_t( sizeof(data) ) )
+         return false;
+      value   = data[0];
+      enabled = data[1];
+      running = data[2];
+      return true;
+   }
+# endif
+}
+
+namespace cmpad {
+   // name
+   const char* perf_counter::name(size_t event)
+   {  static const char* event_name[] = {
+         "cycles",
+         "instructions",
+         "l1d_miss",
+         "llc_miss",
+         "branch_miss",
+         "dtlb_miss"
+      };
+      static_assert( sizeof(event_name) / sizeof(event_name[0]) == n_event );
+      assert( event < n_event );
+      return event_name[event];
+   }
+   //
+   // constructor
+   perf_counter::perf_counter(void)
+   {  for(size_t event = 0; event < n_event; ++event)
+      {  fd_[event]      = -1;
+         value_[event]   = 0;
+         enabled_[event] = 0;
+         running_[event] = 0;
+      }
+   }
+   //
+   // destructor
+   perf_counter::~perf_counter(void)
+   {
+# ifdef __linux__
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( 0 <= fd_[event] )
+            close( fd_[event] );
+      }
+# endif
+   }
+   //
+   // open
+   size_t perf_counter::open(void)
+   {  size_t n_open = 0;
+# ifdef __linux__
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( fd_[event] < 0 )
+            fd_[event] = open_event(event);
+      }
+      reset();
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( 0 <= fd_[event] )
+            ++n_open;
+      }
+# endif
+      return n_open;
+   }
+   //
+   // start
+   void perf_counter::start(void)
+   {
+# ifdef __linux__
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( 0 <= fd_[event] )
+            ioctl(fd_[event], PERF_EVENT_IOC_ENABLE, 0);
+      }
+# endif
+   }
+   //
+   // stop
+   void perf_counter::stop(void)
+   {
+# ifdef __linux__
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( 0 <= fd_[event] )
+            ioctl(fd_[event], PERF_EVENT_IOC_DISABLE, 0);
+      }
+# endif
+   }
+   //
+   // reset
+   // The kernel does not reset the enabled and running times,
+   // so the current values are used as the base for future counts.
+   void perf_counter::reset(void)
+   {
+# ifdef __linux__
+      for(size_t event = 0; event < n_event; ++event)
+      {  if( 0 <= fd_[event] )
+         {  bool ok = read_event(
+               fd_[event], value_[event], enabled_[event], running_[event]
+            );
+            if( ! ok )
+            {  close( fd_[event] );
+               fd_[event] = -1;
+            }
+         }
+      }
+# endif
+   }
+   //
+   // count
+   double perf_counter::count(size_t event) const
+   {  assert( event < n_event );
+      double nan = std::numeric_limits<double>::quiet_NaN();
+# ifdef __linux__
+      if( fd_[event] < 0 )
+         return nan;
+      //
+      // value, enabled, running
+      uint64_t value, enabled, running;
+      if( ! read_event(fd_[event], value, enabled, running) )
+         return nan;
+      //
+      // result
+      double result    = double( value - value_[event] );
+      double d_enabled = double( enabled - enabled_[event] );
+      double d_running = double( running - running_[event] );
+      if( d_running == 0.0 && 0.0 < d_enabled )
+         return nan;
+      if( 0.0 < d_running && d_running < d_enabled )
+         result *= d_enabled / d_running;
+      return result;
+# else
+      return nan;
+# endif
+   }
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin phase_timer}
+{xrst_spell
+   struct
+   underbar
+}
+
+Time the Phases of a Setup
+##########################
+
+Syntax
+******
+| |tab| ``# include <cmpad/phase_timer.hpp>``
+| |tab| ``cmpad::phase_timer::enable`` ( *on* )
+| |tab| *on* = ``cmpad::phase_timer::enabled`` ()
+| |tab| ``cmpad::phase_timer::clear`` ()
+| |tab| ``cmpad::phase_timer`` *timer* ( *name* )
+| |tab| *timer* . ``stop`` ()
+| |tab| *phase_vec* = ``cmpad::phase_timer::phase_vec`` ()
+
+Purpose
+*******
+The setup for some packages has several phases; e.g.,
+recording, optimizing, generating source code, compiling, and loading.
+The gradient :ref:`cpp_gradient@setup` routines use a *timer*
+to tag each of their phases so that we can see which phase dominates
+the setup time.
+
+Enabled
+*******
+The *phase_vec* is a static object that is shared by all the timers.
+Timing is only done when *on* is true (the initial value is false).
+When it is false, constructing and stopping a timer only checks *on* ;
+i.e., it does not read the clock or change *phase_vec* .
+The :ref:`cpp_fun_speed-name` routine enables the timers during the
+first call to setup.
+These routines are not thread safe.
+
+clear
+*****
+This routine removes all of the elements of *phase_vec* .
+
+name
+****
+This ``const char*`` is the name for the phase
+(it must be valid for the lifetime of *timer* ).
+A phase name should only contain letters, digits, and the underbar
+character so that it can be used as part of a
+:ref:`csv_column@Setup Phases` column name.
+
+timer
+*****
+If timing is enabled, the constructor starts the timer for a phase.
+The timer is stopped when ``stop`` is called or when *timer*
+is destroyed, which ever comes first.
+Timers may be nested; e.g., a phase may contain other phases.
+
+phase_vec
+*********
+This ``const cmpad::vector<phase_t>&`` contains the phases
+in the order they were first stopped, where
+{xrst_literal
+   cpp/include/cmpad/phase_timer.hpp
+   // BEGIN PHASE_T
+   // END PHASE_T
+}
+
+If a phase with the same name is stopped more than once,
+*seconds* is the sum of its times.
+
+Trace Events
+************
+If :ref:`trace_event@Enabled` is also true,
+each phase is recorded as a trace event with category ``phase`` .
+
+{xrst_toc_hidden
+   cpp/xam/phase_timer.cpp
+}
+Example
+*******
+:ref:`xam_phase_timer.cpp-name` contains an example and test of this class.
+
+{xrst_end phase_timer}
+------------------------------------------------------------------------------
+*/
+# include <cmpad/phase_timer.hpp>
+# include <cmpad/trace_event.hpp>
+
+namespace {
+   // enabled_
+   bool enabled_ = false;
+   //
+   // phase_vec_
+   cmpad::vector<cmpad::phase_t> phase_vec_;
+}
+
+namespace cmpad {
+   // enable
+   void phase_timer::enable(bool on)
+   {  enabled_ = on; }
+   //
+   // enabled
+   bool phase_timer::enabled(void)
+   {  return enabled_; }
+   //
+   // clear
+   void phase_timer::clear(void)
+   {  phase_vec_.clear(); }
+   //
+   // phase_vec
+   const cmpad::vector<phase_t>& phase_timer::phase_vec(void)
+   {  return phase_vec_; }
+   //
+   // constructor
+   phase_timer::phase_timer(const char* name)
+   {  name_    = name;
+      running_ = enabled_;
+      if( running_ )
+         start_ = std::chrono::steady_clock::now();
+   }
+   //
+   // destructor
+   phase_timer::~phase_timer(void)
+   {  stop(); }
+   //
+   // stop
+   void phase_timer::stop(void)
+   {  if( ! running_ )
+         return;
+      running_ = false;
+      //
+      // seconds
+      std::chrono::steady_clock::time_point end =
+         std::chrono::steady_clock::now();
+      double seconds = std::chrono::duration<double>(end - start_).count();
+      //
+      // trace event
+      trace_event::complete(name_, "phase", start_, end);
+      //
+      // phase_vec_
+      for(size_t i = 0; i < phase_vec_.size(); ++i)
+      {  if( phase_vec_[i].name == name_ )
+         {  phase_vec_[i].seconds += seconds;
+            return;
+         }
+      }
+      phase_t phase;
+      phase.name    = name_;
+      phase.seconds = seconds;
+      phase_vec_.push_back(phase);
+   }
+}
@@ -0,0 +1,541 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin results_query}
+{xrst_spell
+   msg
+   struct
+}
+
+Filter, Group, and Aggregate Speed Results
+##########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/results_query.hpp>``
+| |tab| *msg* = ``cmpad::results_query`` ( *source* , *query* , *table* )
+
+Purpose
+*******
+This routine answers questions like
+"best rate per package for an_ode over the last 30 days" or
+"speedup of codi over cppad for each n_arg".
+It streams the rows of a results file (it does not create the whole table)
+and only keeps the values it needs for the answer.
+It is used by the :ref:`cmpad_query-name` program.
+
+source
+******
+This ``const std::string&`` is a csv file in the
+:ref:`csv_column-name` format, or a directory containing a
+:ref:`results_store-name` .
+The csv file is read using :ref:`csv_scan-name` .
+Only the columns that are used by the query are mapped from a store.
+
+query
+*****
+This ``const query_t&`` specifies the query where
+{xrst_literal
+   cpp/include/cmpad/results_query.hpp
+   // BEGIN QUERY_T
+   // END QUERY_T
+}
+
+where
+=====
+Each element of *where* is a condition of the form
+*name* *op* *text* where *name* is a column name and
+*op* is one of ``=`` , ``!=`` , ``<`` , ``<=`` , ``>`` , ``>=`` .
+If *text* and the value in the column are numbers,
+they are compared as numbers. Otherwise they are compared as strings.
+A row is used if it satisfies all of the conditions.
+A column that is not in *source* has an empty value.
+
+days
+====
+If this is not zero, only rows whose :ref:`csv_column@date` is
+less than *days* days before *today* are used;
+e.g., if *days* is one, only the rows for *today* are used.
+
+today
+=====
+This is the date used by *days* in the format *year*\ ``-``\ *month*\ ``-``\ *day* .
+If it is empty, the current date is used.
+
+group
+=====
+The rows are divided into groups that have the same values for
+the columns in *group* .
+If *group* is empty, all the rows are in one group.
+
+value
+=====
+This is the column that is aggregated for each group; e.g.,
+``rate`` or ``time_median`` .
+Rows where this column is not a number are not used.
+
+stat
+====
+This is one of ``min`` , ``median`` , ``max`` , ``mean`` , or ``count``
+and is the aggregation that is computed for each group.
+
+pivot_row, pivot_col
+====================
+If these are not empty, *group* is not used.
+Instead the rows are grouped by these two columns and the result is a table
+with a row for each value of *pivot_row* and a column for each value
+of *pivot_col* ; e.g., a package by size table using
+``package`` and ``n_arg`` .
+
+base
+====
+If this is not empty, it is a value of *pivot_row* and each cell of the
+pivot table is divided by the cell in the *base* row and the same column.
+For example, if *value* is ``rate`` and *base* is ``cppad`` ,
+the table is the speedup of each package over cppad.
+
+table
+*****
+The input value of this :ref:`vec_vec_str-name` does not matter.
+Upon return, *table* [0] is a header row and the other rows are the result:
+
+#. If there is no pivot, each row has the values of the *group* columns,
+   the number of rows in the group, and the *stat* of *value*
+   (the last column is not present if *stat* is ``count`` ).
+#. If there is a pivot, each row has a value of *pivot_row*
+   followed by a cell for each value of *pivot_col* .
+   A cell is empty if there are no rows for it.
+
+The rows are sorted; values that are numbers come first in numerical order
+and the other values are in string order.
+Numbers in *table* have four significant digits.
+
+msg
+***
+This ``std::string`` is empty if the query succeeded.
+Otherwise it is an error message and *table* is empty.
+
+{xrst_toc_hidden
+   cpp/xam/results_query.cpp
+}
+Example
+*******
+:ref:`xam_results_query.cpp-name` contains an example and test of this routine.
+
+{xrst_end results_query}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cassert>
+# include <cstdint>
+# include <cstdio>
+# include <ctime>
+# include <algorithm>
+# include <array>
+# include <charconv>
+# include <filesystem>
+# include <iomanip>
+# include <map>
+# include <sstream>
+# include <string_view>
+# include <vector>
+# include <cmpad/results_query.hpp>
+# include <cmpad/results_store.hpp>
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/trace_event.hpp>
+
+namespace {
+   // condition_t
+   struct condition_t {
+      size_t      index;
+      std::string op;
+      std::string text;
+      bool        numeric;
+      double      number;
+   };
+   //
+   // to_number
+   // true if all of text is a number
+   bool to_number(std::string_view text, double& number)
+   {  const char* first = text.data();
+      const char* last  = first + text.size();
+      if( first < last && *first == '+' )
+         ++first;
+      if( first == last )
+         return false;
+      std::from_chars_result result = std::from_chars(first, last, number);
+      return result.ec == std::errc() && result.ptr == last;
+   }
+   //
+   // day_number
+   // number of days from 1970-01-01 to year-month-day
+   long day_number(long year, long month, long day)
+   {  year -= month <= 2 ? 1 : 0;
+      long era = (year >= 0 ? year : year - 399) / 400;
+      long yoe = year - era * 400;
+      long doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+      long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+      return era * 146097 + doe - 719468;
+   }
+   //
+   // parse_date
+   bool parse_date(std::string_view text, long& day)
+   {  std::string date(text);
+      int year, month, day_of_month;
+      if( std::sscanf(date.c_str(), "%d-%d-%d", &year, &month, &day_of_month)
+         != 3 )
+         return false;
+      day = day_number(year, month, day_of_month);
+      return true;
+   }
+   //
+   // less_text
+   // numbers come first in numerical order, then strings in string order
+   bool less_text(const std::string& left, const std::string& right)
+   {  double left_number, right_number;
+      bool left_numeric  = to_number(left, left_number);
+      bool right_numeric = to_number(right, right_number);
+      if( left_numeric && right_numeric && left_number != right_number )
+         return left_number < right_number;
+      if( left_numeric != right_numeric )
+         return left_numeric;
+      return left < right;
+   }
+   //
+   // less_key
+   bool less_key(
+      const std::vector<std::string>& left  ,
+      const std::vector<std::string>& right )
+   {  for(size_t k = 0; k < left.size(); ++k)
+      {  if( less_text(left[k], right[k]) )
+            return true;
+         if( less_text(right[k], left[k]) )
+            return false;
+      }
+      return false;
+   }
+   //
+   // statistic
+   double statistic(std::vector<double> x, const std::string& stat)
+   {  size_t n = x.size();
+      if( stat == "count" )
+         return double(n);
+      if( stat == "min" )
+         return *std::min_element(x.begin(), x.end());
+      if( stat == "max" )
+         return *std::max_element(x.begin(), x.end());
+      if( stat == "mean" )
+      {  double sum = 0.0;
+         for(size_t i = 0; i < n; ++i)
+            sum += x[i];
+         return sum / double(n);
+      }
+      assert( stat == "median" );
+      std::sort(x.begin(), x.end());
+      if( n % 2 == 1 )
+         return x[n / 2];
+      return (x[n / 2 - 1] + x[n / 2]) / 2.0;
+   }
+   //
+   // number2string
+   std::string number2string(double value)
+   {  if( std::isnan(value) )
+         return "";
+      std::stringstream ss;
+      ss << std::setprecision(4) << value;
+      return ss.str();
+   }
+}
+
+namespace cmpad {
+   // results_query
+   std::string results_query(
+      const std::string& source ,
+      const query_t&     query  ,
+      vec_vec_str&       table  )
+   {  //
+      // span
+      trace_event span("results_query", "csv");
+      //
+      // table
+      table.clear();
+      //
+      // check stat
+      const std::string& stat = query.stat;
+      if( stat != "min" && stat != "median" && stat != "max" &&
+         stat != "mean" && stat != "count" )
+         return "stat = " + stat + " is not min, median, max, mean, or count";
+      //
+      // pivot
+      bool pivot = query.pivot_row != "" || query.pivot_col != "";
+      if( pivot && (query.pivot_row == "" || query.pivot_col == "") )
+         return "only one of pivot_row and pivot_col is empty";
+      if( query.base != "" && ! pivot )
+         return "base = " + query.base + " is not empty and there is no pivot";
+      //
+      // needed, need
+      // names of the columns that are used by the query
+      std::vector<std::string> needed;
+      auto need = [&needed](const std::string& name)
+      {  size_t k = 0;
+         while( k < needed.size() && needed[k] != name )
+            ++k;
+         if( k == needed.size() )
+            needed.push_back(name);
+         return k;
+      };
+      //
+      // value_index
+      size_t value_index = need(query.value);
+      //
+      // key_name, key_index
+      std::vector<std::string> key_name;
+      if( pivot )
+         key_name = { query.pivot_row, query.pivot_col };
+      else
+      {  for(size_t k = 0; k < query.group.size(); ++k)
+            key_name.push_back( query.group[k] );
+      }
+      std::vector<size_t> key_index;
+      for(size_t k = 0; k < key_name.size(); ++k)
+         key_index.push_back( need(key_name[k]) );
+      //
+      // condition
+      std::vector<condition_t> condition;
+      for(size_t k = 0; k < query.where.size(); ++k)
+      {  const std::string& where = query.where[k];
+         size_t pos = where.find_first_of("!<>=");
+         if( pos == 0 || pos == std::string::npos )
+            return "where = " + where + " is not name op value";
+         size_t n_op = 1;
+         if( pos + 1 < where.size() && where[pos + 1] == '=' )
+            n_op = 2;
+         condition_t element;
+         element.op = where.substr(pos, n_op);
+         if( element.op == "!" )
+            return "where = " + where + " is not name op value";
+         element.index   = need( where.substr(0, pos) );
+         element.text    = where.substr(pos + n_op);
+         element.numeric = to_number(element.text, element.number);
+         condition.push_back(element);
+      }
+      //
+      // date_index, today
+      size_t date_index = 0;
+      long   today      = 0;
+      if( query.days > 0 )
+      {  date_index = need("date");
+         if( query.today != "" )
+         {  if( ! parse_date(query.today, today) )
+               return "today = " + query.today + " is not year-month-day";
+         }
+         else
+         {  std::time_t rawtime;
+            std::time( &rawtime );
+            struct tm* ptm = std::localtime( &rawtime );
+            today = day_number(
+               ptm->tm_year + 1900, ptm->tm_mon + 1, ptm->tm_mday
+            );
+         }
+      }
+      //
+      // group_of
+      std::map< std::vector<std::string>, std::vector<double> > group_of;
+      //
+      // process
+      auto process = [&](const std::vector<std::string_view>& val)
+      {  //
+         // days
+         if( query.days > 0 )
+         {  long day;
+            if( ! parse_date(val[date_index], day) )
+               return;
+            if( day > today || today - day >= long(query.days) )
+               return;
+         }
+         //
+         // condition
+         for(const condition_t& element : condition)
+         {  std::string_view text = val[element.index];
+            double number;
+            int    order;
+            if( element.numeric && to_number(text, number) )
+               order = number < element.number ? -1 :
+                  (number > element.number ? 1 : 0);
+            else
+               order = text.compare(element.text) < 0 ? -1 :
+                  (text.compare(element.text) > 0 ? 1 : 0);
+            bool pass;
+            const std::string& op = element.op;
+            if( op == "=" )
+               pass = order == 0;
+            else if( op == "!=" )
+               pass = order != 0;
+            else if( op == "<" )
+               pass = order < 0;
+            else if( op == "<=" )
+               pass = order <= 0;
+            else if( op == ">" )
+               pass = order > 0;
+            else
+               pass = order >= 0;
+            if( ! pass )
+               return;
+         }
+         //
+         // x
+         double x;
+         if( ! to_number(val[value_index], x) )
+            return;
+         //
+         // group_of
+         std::vector<std::string> key( key_index.size() );
+         for(size_t k = 0; k < key_index.size(); ++k)
+            key[k] = val[ key_index[k] ];
+         group_of[key].push_back(x);
+      };
+      //
+      // val
+      std::vector<std::string_view> val( needed.size() );
+      //
+      // group_of
+      if( std::filesystem::is_directory( std::filesystem::path(source) ) )
+      {  results_store store(source);
+         if( ! store.ok() )
+            return "source = " + source + " is not a results store";
+         //
+         // f64, code, dict
+         size_t n_need = needed.size();
+         std::vector<const double*>   f64(n_need, nullptr);
+         std::vector<const uint32_t*> code(n_need, nullptr);
+         std::vector<const cmpad::vector<std::string>*> dict(n_need, nullptr);
+         for(size_t k = 0; k < n_need; ++k)
+         {  if( store.numeric(needed[k]) )
+               f64[k] = store.f64(needed[k]);
+            else
+            {  code[k] = store.code(needed[k]);
+               dict[k] = &store.dict(needed[k]);
+            }
+         }
+         //
+         // buffer
+         std::vector< std::array<char, 32> > buffer(n_need);
+         for(size_t i = 0; i < store.n_row(); ++i)
+         {  for(size_t k = 0; k < n_need; ++k)
+            {  val[k] = std::string_view();
+               if( f64[k] != nullptr && ! std::isnan( f64[k][i] ) )
+               {  char* first = buffer[k].data();
+                  std::to_chars_result result = std::to_chars(
+                     first, first + buffer[k].size(), f64[k][i]
+                  );
+                  val[k] = std::string_view(first, size_t(result.ptr - first));
+               }
+               if( code[k] != nullptr && code[k][i] < dict[k]->size() )
+                  val[k] = (*dict[k])[ code[k][i] ];
+            }
+            process(val);
+         }
+      }
+      else
+      {  std::vector<size_t> column( needed.size(), std::string::npos );
+         bool ok = csv_scan(source,
+            [&](size_t index, const cmpad::vector<std::string_view>& row)
+            {  if( index == 0 )
+               {  for(size_t k = 0; k < needed.size(); ++k)
+                  {  for(size_t j = 0; j < row.size(); ++j)
+                     {  if( row[j] == needed[k] )
+                           column[k] = j;
+                     }
+                  }
+                  return true;
+               }
+               for(size_t k = 0; k < needed.size(); ++k)
+               {  if( column[k] < row.size() )
+                     val[k] = row[ column[k] ];
+                  else
+                     val[k] = std::string_view();
+               }
+               process(val);
+               return true;
+            }
+         );
+         if( ! ok )
+            return "source = " + source + " cannot be read";
+      }
+      //
+      // key_vec
+      std::vector< std::vector<std::string> > key_vec;
+      for(const auto& element : group_of)
+         key_vec.push_back(element.first);
+      std::sort(key_vec.begin(), key_vec.end(), less_key);
+      //
+      // table
+      if( ! pivot )
+      {  cmpad::vector<std::string> header;
+         for(size_t k = 0; k < key_name.size(); ++k)
+            header.push_back( key_name[k] );
+         header.push_back("count");
+         if( stat != "count" )
+            header.push_back( stat + "_" + query.value );
+         table.push_back(header);
+         for(const std::vector<std::string>& key : key_vec)
+         {  const std::vector<double>& x = group_of[key];
+            cmpad::vector<std::string> row;
+            for(size_t k = 0; k < key.size(); ++k)
+               row.push_back( key[k] );
+            row.push_back( std::to_string( x.size() ) );
+            if( stat != "count" )
+               row.push_back( number2string( statistic(x, stat) ) );
+            table.push_back(row);
+         }
+         return "";
+      }
+      //
+      // row_value, col_value
+      std::vector<std::string> row_value, col_value;
+      for(const std::vector<std::string>& key : key_vec)
+      {  if( std::find(row_value.begin(), row_value.end(), key[0])
+            == row_value.end() )
+            row_value.push_back( key[0] );
+         if( std::find(col_value.begin(), col_value.end(), key[1])
+            == col_value.end() )
+            col_value.push_back( key[1] );
+      }
+      std::sort(row_value.begin(), row_value.end(), less_text);
+      std::sort(col_value.begin(), col_value.end(), less_text);
+      //
+      // cell
+      auto cell = [&](const std::string& row, const std::string& col)
+      {  std::vector<std::string> key = { row, col };
+         if( group_of.find(key) == group_of.end() )
+            return std::nan("");
+         return statistic(group_of[key], stat);
+      };
+      //
+      // check base
+      if( query.base != "" &&
+         std::find(row_value.begin(), row_value.end(), query.base)
+            == row_value.end() )
+         return "base = " + query.base + " is not a value of "
+            + query.pivot_row;
+      //
+      // table
+      cmpad::vector<std::string> header = { query.pivot_row };
+      for(const std::string& col : col_value)
+         header.push_back(col);
+      table.push_back(header);
+      for(const std::string& row : row_value)
+      {  cmpad::vector<std::string> line = { row };
+         for(const std::string& col : col_value)
+         {  double number = cell(row, col);
+            if( query.base != "" )
+               number /= cell(query.base, col);
+            line.push_back( number2string(number) );
+         }
+         table.push_back(line);
+      }
+      return "";
+   }
+}
@@ -0,0 +1,641 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin results_store}
+{xrst_spell
+   dict
+   mmap
+   nan
+   nullptr
+   th
+}
+
+A Columnar Binary Store for Speed Results
+#########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/results_store.hpp>``
+| |tab| ``cmpad::results_store::set_speed_dir`` ( *dir* )
+| |tab| *dir* = ``cmpad::results_store::speed_dir`` ()
+| |tab| *ok* = ``cmpad::results_store::append`` ( *dir* , *col_name* , *col_value* )
+| |tab| ``cmpad::results_store`` *store* ( *dir* )
+| |tab| *ok* = *store* . ``ok`` ()
+| |tab| *n_row* = *store* . ``n_row`` ()
+| |tab| *name_vec* = *store* . ``col_name`` ()
+| |tab| *is_numeric* = *store* . ``numeric`` ( *name* )
+| |tab| *f64* = *store* . ``f64`` ( *name* )
+| |tab| *code* = *store* . ``code`` ( *name* )
+| |tab| *dict* = *store* . ``dict`` ( *name* )
+| |tab| *value* = *store* . ``text`` ( *name* , *row* )
+| |tab| *row_vec* = *store* . ``rows`` ( *package* , *algorithm* , *n_arg* )
+
+Purpose
+*******
+A csv file is easy to read but it is slow to aggregate over
+hundreds of thousands of rows.
+This store keeps each column in a separate binary file,
+so a query only maps the columns that it uses into memory
+(using ``mmap`` ).
+It has the same rows and columns as the
+:ref:`csv_speed <cpp_csv_speed-name>` file.
+
+dir
+***
+This ``std::string`` is the directory that contains the store.
+It is created by *append* if it does not exist.
+
+Format
+******
+The store is only available on Unix systems.
+Each column has a type that is determined by its first non-empty value:
+
+f64
+===
+If the first non-empty value is a number, the column is
+a ``double`` for each row in the file *dir*\ ``/``\ *name*\ ``.f64`` .
+An empty value, or a value that is not a number, is stored as nan.
+The columns that hold the rate, timing statistics, *n_arg* , *n_other* ,
+and counters have this type.
+
+dict
+====
+Otherwise the column is a ``uint32_t`` code for each row in the file
+*dir*\ ``/``\ *name*\ ``.u32`` .
+The *code*-th line of *dir*\ ``/``\ *name*\ ``.dict``
+is the corresponding string value; see :ref:`csv_write@csv_field` .
+For example, the *package* , *algorithm* , and *compiler* columns
+have this type.
+
+Other Files
+===========
+#. The file *dir*\ ``/columns.csv`` has the name and type of each column,
+   in the order that the columns were added to the store.
+#. The ``_key`` column is a dict column with the value
+   *package* , *algorithm* , *n_arg* for each row.
+   It is an index that is used by *rows* .
+   It is written last, so the number of rows in the store
+   is the number of elements in ``_key.u32`` .
+#. The file *dir*\ ``/lock`` is locked while rows are added.
+
+The binary files use the byte order of the machine that writes them.
+
+set_speed_dir
+*************
+If *dir* is not empty, each call to
+:ref:`csv_speed <cpp_csv_speed-name>` also appends its row to
+the store in *dir* .
+The :ref:`csv_column@time_sample` column is not included because
+each of its values is different.
+The initial value for *dir* is empty.
+
+append
+******
+This routine appends one row to the store in *dir* .
+
+col_name
+========
+This ``const cmpad::vector<std::string>&`` is the names of the columns
+for this row.
+A column that is not already in the store is added
+(and the previous rows have missing values for the column);
+unless its value is empty, in which case the column is not added.
+Columns that are in the store, but not in *col_name* ,
+have a missing value for this row.
+
+col_value
+=========
+This ``const cmpad::vector<std::string>&`` has the same size as
+*col_name* and is the values for this row.
+
+ok
+==
+This ``bool`` is true if the row was written.
+Otherwise an error message is printed on ``std::cerr`` .
+If :ref:`csv_append@fsync` is enabled,
+each file is flushed to disk after it is written.
+
+store
+*****
+This object maps the columns of the store in *dir* into memory
+when they are used.
+The mappings are removed when *store* is destroyed.
+Rows that are appended after *store* is constructed are not included.
+
+ok
+==
+This ``bool`` is false if *dir* does not contain a store.
+
+n_row
+=====
+This ``size_t`` is the number of rows in the store.
+
+name_vec
+========
+This ``const cmpad::vector<std::string>&`` is the name of each column
+in the store (not including ``_key`` ).
+
+is_numeric
+==========
+This ``bool`` is true if *name* is a column with type f64.
+
+f64
+===
+This ``const double*`` points to the *n_row* values in the column *name* .
+It is ``nullptr`` if *name* is not an f64 column or *n_row* is zero.
+
+code
+====
+This ``const uint32_t*`` points to the *n_row* codes in the column *name* .
+It is ``nullptr`` if *name* is not a dict column or *n_row* is zero.
+
+dict
+====
+This ``const cmpad::vector<std::string>&`` is the strings for the codes
+in the column *name* ; i.e., *dict* [ *code* [ *i* ] ] is the value
+for the *i*-th row.
+It is empty if *name* is not a dict column.
+
+text
+====
+This ``std::string`` is the value for column *name* and row index *row* .
+A number is converted using six significant digits and a missing number
+is the empty string.
+
+rows
+====
+This ``cmpad::vector<size_t>`` contains the index of the rows,
+in increasing order, that have the specified
+``std::string`` *package* , ``std::string`` *algorithm* ,
+and ``size_t`` *n_arg* .
+Only the ``_key`` column is mapped to compute it.
+
+{xrst_toc_hidden
+   cpp/xam/results_store.cpp
+}
+Example
+*******
+:ref:`xam_results_store.cpp-name` contains an example and test of this class.
+
+{xrst_end results_store}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cstdlib>
+# include <cstring>
+# include <iostream>
+# include <limits>
+# include <sstream>
+# include <filesystem>
+# include <cmpad/results_store.hpp>
+# include <cmpad/csv_append.hpp>
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/csv_write.hpp>
+# include <cmpad/trace_event.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <cerrno>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/file.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# endif
+
+namespace {
+   // speed_dir_
+   std::string speed_dir_ = "";
+   //
+   // key_name
+   const std::string key_name = "_key";
+   //
+   // to_number
+   // true if all of value is a number
+   bool to_number(const std::string& value, double& number)
+   {  if( value.empty() )
+         return false;
+      char* end;
+      number = std::strtod(value.c_str(), &end);
+      return *end == '\0';
+   }
+   //
+   // key_value
+   std::string key_value(
+      const std::string& package   ,
+      const std::string& algorithm ,
+      const std::string& n_arg     )
+   {  return cmpad::csv_field(package) + ","
+         + cmpad::csv_field(algorithm) + "," + n_arg;
+   }
+   //
+   // read_columns
+   // the columns in dir/columns.csv
+   bool read_columns(
+      const std::string&             dir        ,
+      cmpad::vector<std::string>&    order      ,
+      std::map<std::string, bool>&   numeric_of )
+   {  std::string path = dir + "/columns.csv";
+      if( ! std::filesystem::exists( std::filesystem::path(path) ) )
+         return false;
+      return cmpad::csv_scan(path,
+         [&](size_t index, const cmpad::vector<std::string_view>& row)
+         {  if( index > 0 && row.size() == 2 )
+            {  std::string name( row[0] );
+               order.push_back(name);
+               numeric_of[name] = row[1] == "f64";
+            }
+            return true;
+         }
+      );
+   }
+# if defined(__unix__) || defined(__APPLE__)
+   //
+   // file_size
+   // zero if the file does not exist
+   size_t file_size(const std::string& path)
+   {  struct stat status;
+      if( stat(path.c_str(), &status) != 0 )
+         return 0;
+      return size_t( status.st_size );
+   }
+   //
+   // pwrite_all
+   bool pwrite_all(int fd, const std::string& text, size_t offset)
+   {  const char* data = text.data();
+      size_t      left = text.size();
+      while( left > 0 )
+      {  ssize_t n_write = pwrite(fd, data, left, off_t(offset) );
+         if( n_write < 0 && errno == EINTR )
+            continue;
+         if( n_write <= 0 )
+            return false;
+         data   += n_write;
+         left   -= size_t(n_write);
+         offset += size_t(n_write);
+      }
+      return true;
+   }
+   //
+   // put_element
+   // set the number of elements in the file to n_row, using missing for
+   // padding, and then write element as element index n_row
+   bool put_element(
+      const std::string& path      ,
+      size_t             n_row     ,
+      const std::string& missing   ,
+      const std::string& element   )
+   {  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0644);
+      if( fd < 0 )
+         return false;
+      size_t elem_size = element.size();
+      size_t n_have    = file_size(path) / elem_size;
+      bool   ok        = true;
+      if( n_have * elem_size != file_size(path) || n_row < n_have )
+      {  n_have = std::min(n_have, n_row);
+         ok    &= ftruncate(fd, off_t(n_have * elem_size) ) == 0;
+      }
+      std::string text;
+      for(size_t i = n_have; i < n_row; ++i)
+         text += missing;
+      text += element;
+      ok   &= pwrite_all(fd, text, n_have * elem_size);
+      if( ok && cmpad::csv_append::fsync_enabled() )
+         ok = fsync(fd) == 0;
+      close(fd);
+      return ok;
+   }
+   //
+   // dict_code
+   // code for value in the dictionary file path (added if not present)
+   bool dict_code(const std::string& path, const std::string& value, uint32_t& code)
+   {  code       = 0;
+      bool found = false;
+      if( file_size(path) > 0 )
+      {  bool ok = cmpad::csv_scan(path,
+            [&](size_t index, const cmpad::vector<std::string_view>& row)
+            {  if( row.size() == 1 && row[0] == value )
+               {  code  = uint32_t(index);
+                  found = true;
+                  return false;
+               }
+               code = uint32_t(index + 1);
+               return true;
+            }
+         );
+         if( ! ok )
+            return false;
+      }
+      if( found )
+         return true;
+      int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+      if( fd < 0 )
+         return false;
+      bool ok = pwrite_all(fd, cmpad::csv_field(value) + "\n", 0);
+      if( ok && cmpad::csv_append::fsync_enabled() )
+         ok = fsync(fd) == 0;
+      close(fd);
+      return ok;
+   }
+   //
+   // put_value
+   bool put_value(
+      const std::string& dir       ,
+      const std::string& name      ,
+      bool               numeric   ,
+      size_t             n_row     ,
+      const std::string& value     )
+   {  if( numeric )
+      {  double nan    = std::numeric_limits<double>::quiet_NaN();
+         double number = nan;
+         if( ! to_number(value, number) )
+            number = nan;
+         std::string missing( reinterpret_cast<const char*>(&nan), 8);
+         std::string element( reinterpret_cast<const char*>(&number), 8);
+         return put_element(dir + "/" + name + ".f64", n_row, missing, element);
+      }
+      std::string dict_path = dir + "/" + name + ".dict";
+      std::string code_path = dir + "/" + name + ".u32";
+      uint32_t code;
+      if( ! dict_code(dict_path, value, code) )
+         return false;
+      uint32_t empty = code;
+      if( file_size(code_path) != 4 * n_row && value != "" )
+      {  if( ! dict_code(dict_path, "", empty) )
+            return false;
+      }
+      std::string missing( reinterpret_cast<const char*>(&empty), 4);
+      std::string element( reinterpret_cast<const char*>(&code), 4);
+      return put_element(code_path, n_row, missing, element);
+   }
+# endif
+}
+
+namespace cmpad {
+   // set_speed_dir
+   void results_store::set_speed_dir(const std::string& dir)
+   {  speed_dir_ = dir; }
+   //
+   // speed_dir
+   const std::string& results_store::speed_dir(void)
+   {  return speed_dir_; }
+   //
+   // append
+   bool results_store::append(
+      const std::string&                dir       ,
+      const cmpad::vector<std::string>& col_name  ,
+      const cmpad::vector<std::string>& col_value )
+   {  //
+      // span
+      trace_event span("results_store", "csv");
+# if ! (defined(__unix__) || defined(__APPLE__))
+      std::cerr << "results_store: not available on this system\n";
+      return false;
+# else
+      //
+      // dir
+      std::error_code error;
+      std::filesystem::create_directories( std::filesystem::path(dir), error );
+      //
+      // lock_fd
+      std::string lock_path = dir + "/lock";
+      int lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+      if( lock_fd < 0 )
+      {  std::cerr << "results_store: error opening " << lock_path
+            << ": " << std::strerror(errno) << "\n";
+         return false;
+      }
+      int result = flock(lock_fd, LOCK_EX);
+      while( result != 0 && errno == EINTR )
+         result = flock(lock_fd, LOCK_EX);
+      if( result != 0 )
+      {  std::cerr << "results_store: error locking " << lock_path
+            << ": " << std::strerror(errno) << "\n";
+         close(lock_fd);
+         return false;
+      }
+      //
+      // order, numeric_of
+      cmpad::vector<std::string>  order;
+      std::map<std::string, bool> numeric_of;
+      read_columns(dir, order, numeric_of);
+      //
+      // n_row
+      size_t n_row = file_size(dir + "/" + key_name + ".u32") / 4;
+      //
+      // value_of
+      std::map<std::string, std::string> value_of;
+      for(size_t j = 0; j < col_name.size(); ++j)
+         value_of[ col_name[j] ] = col_value[j];
+      //
+      // ok, order, numeric_of
+      // add the new columns that have a value
+      bool ok = true;
+      for(size_t j = 0; j < col_name.size(); ++j)
+      {  const std::string& name = col_name[j];
+         bool add = numeric_of.find(name) == numeric_of.end();
+         add     &= col_value[j] != "" && name != key_name;
+         if( add )
+         {  double number;
+            bool numeric = to_number(col_value[j], number);
+            vec_vec_str row_vec = { { name, numeric ? "f64" : "dict" } };
+            ok &= csv_append::rows(
+               dir + "/columns.csv", { "name", "type" }, row_vec, false
+            );
+            order.push_back(name);
+            numeric_of[name] = numeric;
+         }
+      }
+      //
+      // ok
+      for(size_t k = 0; k < order.size(); ++k)
+      {  const std::string& name = order[k];
+         std::string value = "";
+         if( value_of.find(name) != value_of.end() )
+            value = value_of[name];
+         ok &= put_value(dir, name, numeric_of[name], n_row, value);
+      }
+      //
+      // ok
+      // the key is written last, so it determines the number of rows
+      if( ok )
+      {  std::string key = key_value(
+            value_of["package"], value_of["algorithm"], value_of["n_arg"]
+         );
+         ok &= put_value(dir, key_name, false, n_row, key);
+      }
+      if( ! ok )
+         std::cerr << "results_store: error writing to " << dir << "\n";
+      //
+      // unlock
+      flock(lock_fd, LOCK_UN);
+      close(lock_fd);
+      return ok;
+# endif
+   }
+   //
+   // constructor
+   results_store::results_store(const std::string& dir)
+   : dir_(dir), ok_(false), n_row_(0)
+   {  std::map<std::string, bool> numeric_of;
+      ok_ = read_columns(dir, col_name_, numeric_of);
+# if ! (defined(__unix__) || defined(__APPLE__))
+      ok_ = false;
+# else
+      if( ok_ )
+         n_row_ = file_size(dir + "/" + key_name + ".u32") / 4;
+# endif
+      numeric_of[key_name] = false;
+      for(const auto& element : numeric_of)
+      {  column_t column;
+         column.numeric   = element.second;
+         column.data      = nullptr;
+         column.size      = 0;
+         column.dict_read = false;
+         column_[element.first] = column;
+      }
+   }
+   //
+   // destructor
+   results_store::~results_store(void)
+   {
+# if defined(__unix__) || defined(__APPLE__)
+      for(const auto& element : column_)
+      {  if( element.second.data != nullptr )
+            munmap( const_cast<void*>(element.second.data), element.second.size );
+      }
+# endif
+   }
+   //
+   // load_
+   results_store::column_t* results_store::load_(
+      const std::string& name, bool numeric )
+   {  std::map<std::string, column_t>::iterator itr = column_.find(name);
+      if( itr == column_.end() || itr->second.numeric != numeric )
+         return nullptr;
+      column_t& column = itr->second;
+# if defined(__unix__) || defined(__APPLE__)
+      if( column.data == nullptr && n_row_ > 0 )
+      {  std::string path = dir_ + "/" + name + (numeric ? ".f64" : ".u32");
+         size_t      size = n_row_ * (numeric ? 8 : 4);
+         int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+         if( fd < 0 )
+            return nullptr;
+         void* map = MAP_FAILED;
+         if( size <= file_size(path) )
+            map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+         close(fd);
+         if( map == MAP_FAILED )
+            return nullptr;
+         column.data = map;
+         column.size = size;
+      }
+# endif
+      return &column;
+   }
+   //
+   // ok
+   bool results_store::ok(void) const
+   {  return ok_; }
+   //
+   // n_row
+   size_t results_store::n_row(void) const
+   {  return n_row_; }
+   //
+   // col_name
+   const cmpad::vector<std::string>& results_store::col_name(void) const
+   {  return col_name_; }
+   //
+   // numeric
+   bool results_store::numeric(const std::string& name) const
+   {  std::map<std::string, column_t>::const_iterator itr = column_.find(name);
+      return itr != column_.end() && itr->second.numeric;
+   }
+   //
+   // f64
+   const double* results_store::f64(const std::string& name)
+   {  column_t* column = load_(name, true);
+      if( column == nullptr )
+         return nullptr;
+      return static_cast<const double*>( column->data );
+   }
+   //
+   // code
+   const uint32_t* results_store::code(const std::string& name)
+   {  column_t* column = load_(name, false);
+      if( column == nullptr )
+         return nullptr;
+      return static_cast<const uint32_t*>( column->data );
+   }
+   //
+   // dict
+   const cmpad::vector<std::string>& results_store::dict(const std::string& name)
+   {  static const cmpad::vector<std::string> empty;
+      std::map<std::string, column_t>::iterator itr = column_.find(name);
+      if( itr == column_.end() || itr->second.numeric )
+         return empty;
+      column_t& column = itr->second;
+      if( ! column.dict_read )
+      {  column.dict_read = true;
+         std::string path = dir_ + "/" + name + ".dict";
+         if( std::filesystem::exists( std::filesystem::path(path) ) )
+         {  csv_scan(path,
+               [&column](size_t, const cmpad::vector<std::string_view>& row)
+               {  column.dict.push_back( std::string( row[0] ) );
+                  return true;
+               }
+            );
+         }
+      }
+      return column.dict;
+   }
+   //
+   // text
+   std::string results_store::text(const std::string& name, size_t row)
+   {  if( n_row_ <= row )
+         return "";
+      if( numeric(name) )
+      {  const double* data = f64(name);
+         if( data == nullptr || std::isnan( data[row] ) )
+            return "";
+         std::stringstream ss;
+         ss << data[row];
+         return ss.str();
+      }
+      const uint32_t* data = code(name);
+      const cmpad::vector<std::string>& strings = dict(name);
+      if( data == nullptr || strings.size() <= data[row] )
+         return "";
+      return strings[ data[row] ];
+   }
+   //
+   // rows
+   cmpad::vector<size_t> results_store::rows(
+      const std::string& package   ,
+      const std::string& algorithm ,
+      size_t             n_arg     )
+   {  cmpad::vector<size_t> result;
+      //
+      // key_code
+      std::string key = key_value(package, algorithm, std::to_string(n_arg) );
+      const cmpad::vector<std::string>& strings = dict(key_name);
+      size_t key_code = strings.size();
+      for(size_t k = 0; k < strings.size(); ++k)
+      {  if( strings[k] == key )
+            key_code = k;
+      }
+      if( key_code == strings.size() )
+         return result;
+      //
+      // result
+      const uint32_t* data = code(key_name);
+      if( data == nullptr )
+         return result;
+      for(size_t i = 0; i < n_row_; ++i)
+      {  if( data[i] == key_code )
+            result.push_back(i);
+      }
+      return result;
+   }
+}
@@ -0,0 +1,421 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin sample_profiler}
+{xrst_spell
+   ms
+   os
+   rdynamic
+   setitimer
+   sigprof
+}
+
+A Sampling Profiler That Does Not Need perf
+###########################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/sample_profiler.hpp>``
+| |tab| *ok* = ``cmpad::sample_profiler::start`` ( *interval* )
+| |tab| ``cmpad::sample_profiler::stop`` ()
+| |tab| ``cmpad::sample_profiler::pause`` ( *paused* )
+| |tab| *on* = ``cmpad::sample_profiler::running`` ()
+| |tab| *n_sample* = ``cmpad::sample_profiler::n_sample`` ()
+| |tab| *n_lost* = ``cmpad::sample_profiler::n_lost`` ()
+| |tab| *profile* = ``cmpad::sample_profiler::profile`` ()
+| |tab| ``cmpad::sample_profiler::print`` ( *os* , *profile* , *n_sample* , *n_line* )
+
+Purpose
+*******
+Some of the machines we benchmark on do not allow ``perf`` .
+This profiler uses ``setitimer`` to send a ``SIGPROF`` signal
+to the process after every *interval* seconds of processor time.
+The signal handler records the call stack using ``backtrace`` .
+After the profiler is stopped, the call stacks are converted to
+function names and counted.
+This shows, for example, how much of a gradient computation is spent
+resetting a tape and how much is spent evaluating it.
+
+Operating System
+****************
+The profiler is only available on Linux.
+On other systems, *start* returns false and *n_sample* is zero.
+
+interval
+********
+This ``double`` is the processor time, in seconds, between samples;
+e.g., 1e-3 for one sample every millisecond.
+It must be greater than zero.
+The kernel may round it up to a multiple of its clock tick; e.g., 4 ms.
+
+start
+*****
+This routine clears the previous samples and starts the profiler.
+The return value *ok* is false if the profiler was already running,
+or if the signal handler or timer could not be installed;
+in this case the profiler is not running.
+The memory for the samples is allocated by ``start`` ,
+so the signal handler does not allocate any memory.
+
+stop
+****
+This routine stops the timer and restores the previous ``SIGPROF`` handler.
+It does nothing if the profiler is not running.
+
+pause
+*****
+If the ``bool`` *paused* is true (false),
+the signals that arrive after this call are not (are) recorded;
+e.g., to leave out the time for :ref:`cache_info@flush_cache`
+between computations.
+The timer keeps running, so the time while paused is not attributed to
+the code that runs after the pause.
+The profiler is not paused when it is started.
+
+running
+*******
+This ``bool`` is true if the profiler has been started and not stopped.
+
+n_sample
+********
+This ``size_t`` is the number of call stacks that were recorded.
+At most 16384 call stacks are recorded between a start and a stop.
+
+n_lost
+******
+This ``size_t`` is the number of samples that were not recorded because
+the maximum number of call stacks was reached.
+
+profile
+*******
+This ``cmpad::vector<profile_t>`` contains one element for each function
+that appears in the recorded call stacks, where
+{xrst_literal
+   cpp/include/cmpad/sample_profiler.hpp
+   // BEGIN PROFILE_T
+   // END PROFILE_T
+}
+It should only be called when the profiler is not running.
+It is sorted by decreasing *flat* value and then by decreasing
+*cumulative* value.
+
+name
+====
+is the demangled function name.
+If a name is not available, it is the library or program that contains
+the address in brackets; e.g., ``[libc.so.6]`` .
+A program must be linked with ``-rdynamic`` to have the names of the
+functions in the program itself
+(the C++ version of run_cmpad is linked this way).
+Functions that are inlined are included in the function they are inlined in.
+
+flat
+====
+is the number of samples where the function was executing;
+i.e., the top of the call stack.
+
+cumulative
+==========
+is the number of samples where the function was in the call stack;
+i.e., the function or a function that it called was executing.
+Only the first 32 frames of a call stack are recorded.
+
+print
+*****
+This routine prints a flat profile and a cumulative profile to the
+``std::ostream`` *os* .
+Each line has the percent of *n_sample* , the number of samples,
+and the function name.
+
+n_line
+======
+This ``size_t`` is the maximum number of lines for each of the profiles.
+
+{xrst_toc_hidden
+   cpp/xam/sample_profiler.cpp
+}
+Example
+*******
+:ref:`xam_sample_profiler.cpp-name` contains an example and test of
+this class.
+
+{xrst_end sample_profiler}
+------------------------------------------------------------------------------
+*/
+# include <cerrno>
+# include <cstdlib>
+# include <cstring>
+# include <atomic>
+# include <algorithm>
+# include <iomanip>
+# include <map>
+# include <sstream>
+# include <vector>
+# include <cmpad/sample_profiler.hpp>
+
+# ifdef __linux__
+# include <signal.h>
+# include <sys/time.h>
+# include <execinfo.h>
+# include <dlfcn.h>
+# include <cxxabi.h>
+# endif
+
+namespace {
+   // max_depth, max_sample
+   const size_t max_depth  = 32;
+   const size_t max_sample = 16384;
+   //
+   // n_skip
+   // number of frames for the signal handler and the signal trampoline
+   const int n_skip = 2;
+   //
+   // running_
+   bool running_ = false;
+   //
+   // n_taken_
+   // number of signals that have been handled since the last start
+   std::atomic<size_t> n_taken_(0);
+   //
+   // paused_
+   // true if the signals are not recorded
+   std::atomic<bool> paused_(false);
+   //
+   // frame_, depth_
+   // call stack for sample i is frame_[i * max_depth + j] for j < depth_[i]
+   std::vector<void*> frame_;
+   std::vector<int>   depth_;
+# ifdef __linux__
+   //
+   // old_action_
+   struct sigaction old_action_;
+   //
+   // handler
+   void handler(int)
+   {  if( paused_.load(std::memory_order_relaxed) )
+         return;
+      int saved_errno = errno;
+      size_t index = n_taken_.fetch_add(1, std::memory_order_relaxed);
+      if( index < max_sample )
+      {  void** frame = frame_.data() + index * max_depth;
+         depth_[index] = backtrace(frame, int(max_depth) );
+      }
+      errno = saved_errno;
+   }
+   //
+   // symbol_name
+   std::string symbol_name(void* address)
+   {  Dl_info info;
+      if( dladdr(address, &info) == 0 )
+         return "[unknown]";
+      if( info.dli_sname == nullptr )
+      {  std::string file = "unknown";
+         if( info.dli_fname != nullptr )
+            file = info.dli_fname;
+         size_t slash = file.rfind('/');
+         if( slash != std::string::npos )
+            file = file.substr(slash + 1);
+         return "[" + file + "]";
+      }
+      int   status;
+      char* demangled =
+         abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+      if( demangled == nullptr )
+         return info.dli_sname;
+      std::string name = demangled;
+      std::free(demangled);
+      return name;
+   }
+# endif
+}
+
+namespace cmpad {
+   // start
+   bool sample_profiler::start(double interval)
+   {  if( running_ || ! (0.0 < interval) )
+         return false;
+# ifndef __linux__
+      return false;
+# else
+      //
+      // frame_, depth_, n_taken_
+      frame_.resize(max_sample * max_depth);
+      depth_.assign(max_sample, 0);
+      n_taken_ = 0;
+      paused_  = false;
+      //
+      // backtrace
+      // the first call may load a library, which is not safe in a handler
+      void* dummy[1];
+      backtrace(dummy, 1);
+      //
+      // old_action_
+      struct sigaction action;
+      std::memset(&action, 0, sizeof(action) );
+      action.sa_handler = handler;
+      action.sa_flags   = SA_RESTART;
+      sigemptyset(&action.sa_mask);
+      if( sigaction(SIGPROF, &action, &old_action_) != 0 )
+         return false;
+      //
+      // timer
+      struct itimerval timer;
+      long micro = std::max( long(interval * 1e6), 1L );
+      timer.it_interval.tv_sec  = micro / 1000000;
+      timer.it_interval.tv_usec = micro % 1000000;
+      timer.it_value            = timer.it_interval;
+      if( setitimer(ITIMER_PROF, &timer, nullptr) != 0 )
+      {  sigaction(SIGPROF, &old_action_, nullptr);
+         return false;
+      }
+      running_ = true;
+      return true;
+# endif
+   }
+   //
+   // stop
+   void sample_profiler::stop(void)
+   {  if( ! running_ )
+         return;
+# ifdef __linux__
+      struct itimerval timer;
+      std::memset(&timer, 0, sizeof(timer) );
+      setitimer(ITIMER_PROF, &timer, nullptr);
+      sigaction(SIGPROF, &old_action_, nullptr);
+# endif
+      running_ = false;
+   }
+   //
+   // pause
+   void sample_profiler::pause(bool paused)
+   {  paused_.store(paused, std::memory_order_relaxed); }
+   //
+   // running
+   bool sample_profiler::running(void)
+   {  return running_; }
+   //
+   // n_sample
+   size_t sample_profiler::n_sample(void)
+   {  return std::min( n_taken_.load(), max_sample ); }
+   //
+   // n_lost
+   size_t sample_profiler::n_lost(void)
+   {  return n_taken_.load() - n_sample(); }
+   //
+   // profile
+   cmpad::vector<profile_t> sample_profiler::profile(void)
+   {  cmpad::vector<profile_t> result;
+# ifdef __linux__
+      //
+      // name_of
+      // cache of the names for each address
+      std::map<void*, std::string> name_of;
+      //
+      // index_of
+      // index in result for each name
+      std::map<std::string, size_t> index_of;
+      //
+      // result
+      size_t n_recorded = n_sample();
+      for(size_t i = 0; i < n_recorded; ++i)
+      {  void** frame = frame_.data() + i * max_depth;
+         //
+         // seen
+         // functions that have already been counted for this sample
+         std::vector<size_t> seen;
+         for(int j = n_skip; j < depth_[i]; ++j)
+         {  //
+            // address
+            // a return address can be the first address after a function,
+            // so use the address of the call instruction instead
+            char* address = static_cast<char*>( frame[j] );
+            if( j > n_skip )
+               --address;
+            //
+            // name
+            std::map<void*, std::string>::iterator itr = name_of.find(address);
+            if( itr == name_of.end() )
+               itr = name_of.emplace( address, symbol_name(address) ).first;
+            const std::string& name = itr->second;
+            //
+            // index
+            size_t index;
+            std::map<std::string, size_t>::iterator jtr = index_of.find(name);
+            if( jtr != index_of.end() )
+               index = jtr->second;
+            else
+            {  index = result.size();
+               index_of[name] = index;
+               profile_t element;
+               element.name       = name;
+               element.flat       = 0;
+               element.cumulative = 0;
+               result.push_back(element);
+            }
+            //
+            // result
+            if( j == n_skip )
+               ++result[index].flat;
+            if( std::find(seen.begin(), seen.end(), index) == seen.end() )
+            {  ++result[index].cumulative;
+               seen.push_back(index);
+            }
+         }
+      }
+      //
+      // result
+      std::sort(result.begin(), result.end(),
+         [](const profile_t& left, const profile_t& right)
+         {  if( left.flat != right.flat )
+               return left.flat > right.flat;
+            return left.cumulative > right.cumulative;
+         }
+      );
+# endif
+      return result;
+   }
+   //
+   // print
+   void sample_profiler::print(
+      std::ostream&                   os        ,
+      const cmpad::vector<profile_t>& profile   ,
+      size_t                          n_sample  ,
+      size_t                          n_line    )
+   {  //
+      // print_table
+      auto print_table = [&](const char* title, bool flat)
+      {  //
+         // order
+         cmpad::vector<size_t> order(profile.size());
+         for(size_t k = 0; k < profile.size(); ++k)
+            order[k] = k;
+         if( ! flat )
+         {  std::stable_sort(order.begin(), order.end(),
+               [&](size_t left, size_t right)
+               {  return profile[left].cumulative > profile[right].cumulative;
+               }
+            );
+         }
+         //
+         // os
+         os << title << " profile: " << n_sample << " samples\n";
+         os << std::setw(8) << "percent" << std::setw(10) << "samples"
+            << "  function\n";
+         for(size_t k = 0; k < std::min(n_line, profile.size()); ++k)
+         {  const profile_t& element = profile[ order[k] ];
+            size_t count = flat ? element.flat : element.cumulative;
+            if( count == 0 )
+               break;
+            double percent = 100.0 * double(count) / double(n_sample);
+            os << std::fixed << std::setprecision(1)
+               << std::setw(8) << percent << std::setw(10) << count
+               << "  " << element.name << "\n";
+         }
+         os << std::defaultfloat;
+      };
+      print_table("flat", true);
+      print_table("cumulative", false);
+   }
+}
@@ -0,0 +1,237 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin speed_clock}
+{xrst_spell
+   rdtscp
+   tsc
+}
+
+Clocks Used to Time Computations
+################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/speed_clock.hpp>``
+| |tab| *ok* = ``cmpad::speed_clock::available`` ( *name* )
+| |tab| ``cmpad::speed_clock`` *clock* ( *name* )
+| |tab| *name* = *clock* . ``name`` ()
+| |tab| *tick* = *clock* . ``tick`` ()
+| |tab| *seconds* = *clock* . ``seconds`` ( *n_tick* )
+| |tab| *overhead* = *clock* . ``overhead`` ()
+| |tab| *seconds* = *clock* . ``empty_pass`` ( *pool* , *i_pool* , *repeat* , *flush* )
+
+Purpose
+*******
+The fastest computations take less than 100 nanoseconds,
+so the resolution and the cost of reading the clock matter.
+This class selects one of the following clocks:
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   name, clock
+   steady, ``std::chrono::steady_clock``
+   tsc,    the processor time stamp counter (the ``rdtscp`` instruction)
+   raw,    ``clock_gettime`` with ``CLOCK_MONOTONIC_RAW``
+
+The *tsc* clock is only available on x86 processors and the
+*raw* clock is only available on systems that define
+``CLOCK_MONOTONIC_RAW`` ; e.g., Linux.
+The *tsc* clock assumes that the time stamp counter has a constant rate
+(which is the case for most recent x86 processors).
+
+name
+****
+This ``std::string`` is one of the names in the table above.
+If it is not available, the constructor prints an error message
+and exits the program.
+
+ok
+**
+This ``bool`` is true (false) if the clock *name* is available
+(is not available) on this system.
+
+tick
+****
+This ``uint64_t`` value is the current value of the clock in
+units of its ticks.
+It is an inline function so that it is as cheap as possible to call.
+
+seconds
+*******
+This ``double`` value is the number of seconds corresponding to
+*n_tick* ticks of the clock; i.e., the difference of two *tick* values.
+For the *tsc* clock, the number of ticks per second is calibrated
+against the steady clock the first time a *tsc* clock is constructed
+(this takes about 20 milliseconds).
+For the other clocks, a tick is one nanosecond.
+
+overhead
+********
+This ``double`` value is the minimum, over many trials, of the seconds between
+two consecutive calls to *tick* ; i.e., the cost of reading the clock.
+
+empty_pass
+**********
+This ``double`` value is the seconds for a timing pass that
+does not compute a function object; i.e.,
+the overhead for reading the clock and for the loop that
+selects the next argument vector.
+It is used by :ref:`cpp_fun_speed-name` and :ref:`fun_compare-name` .
+
+#. *pool* is the ``const cmpad::vector< cmpad::vector<double> >&``
+   pool of argument vectors.
+#. *i_pool* is a ``size_t&`` index in *pool* of the next argument vector.
+   It is advanced, modulo the size of *pool* , once for each of the
+   *repeat* loop iterations.
+#. If the ``bool`` *flush* is true, the clock is read twice for each
+   iteration and the seconds between the reads are returned
+   (this matches the separate timing of each computation when the
+   caches are flushed).
+   Otherwise the seconds for the whole loop are returned.
+
+The address of each argument vector is stored in a ``volatile`` variable
+so that the compiler cannot remove the loop.
+
+{xrst_toc_hidden
+   cpp/xam/speed_clock.cpp
+}
+Example
+*******
+:ref:`xam_speed_clock.cpp-name` contains an example and test of this class.
+
+{xrst_end speed_clock}
+------------------------------------------------------------------------------
+*/
+# include <iostream>
+# include <algorithm>
+# include <cmpad/speed_clock.hpp>
+
+namespace {
+   // empty_sink
+   // empty_pass stores the argument addresses here so the loop is not removed
+   const cmpad::vector<double>* volatile empty_sink = nullptr;
+   //
+   // kind_of
+   // returns false if name is not a valid clock name on this system
+   bool kind_of(const std::string& name, cmpad::speed_clock::kind_t& kind)
+   {  if( name == "steady" )
+      {  kind = cmpad::speed_clock::steady_enum;
+         return true;
+      }
+# if CMPAD_SPEED_CLOCK_TSC
+      if( name == "tsc" )
+      {  kind = cmpad::speed_clock::tsc_enum;
+         return true;
+      }
+# endif
+# ifdef CLOCK_MONOTONIC_RAW
+      if( name == "raw" )
+      {  kind = cmpad::speed_clock::raw_enum;
+         return true;
+      }
+# endif
+      return false;
+   }
+   //
+   // tsc_second_per_tick
+   // calibrate the time stamp counter against the steady clock
+   double tsc_second_per_tick(const cmpad::speed_clock& clock)
+   {  using std::chrono::steady_clock;
+      typedef std::chrono::duration<double> duration;
+      //
+      // t_start, tick_start
+      steady_clock::time_point t_start    = steady_clock::now();
+      uint64_t                 tick_start = clock.tick();
+      //
+      // t_end, tick_end
+      // busy wait for 20 milliseconds
+      steady_clock::time_point t_end;
+      double seconds = 0.0;
+      while( seconds < 0.02 )
+      {  t_end   = steady_clock::now();
+         seconds = duration(t_end - t_start).count();
+      }
+      uint64_t tick_end = clock.tick();
+      //
+      return seconds / double(tick_end - tick_start);
+   }
+}
+
+namespace cmpad {
+   // available
+   bool speed_clock::available(const std::string& name)
+   {  kind_t kind;
+      return kind_of(name, kind);
+   }
+   //
+   // constructor
+   speed_clock::speed_clock(const std::string& name)
+   {  if( ! kind_of(name, kind_) )
+      {  std::cerr << "cmpad::speed_clock: clock = " << name
+                   << " is not available\n";
+         std::exit(1);
+      }
+      second_per_tick_ = 1e-9;
+      if( kind_ == tsc_enum )
+      {  // the calibration is only done once
+         static double tsc_second = tsc_second_per_tick(*this);
+         second_per_tick_ = tsc_second;
+      }
+   }
+   //
+   // name
+   const char* speed_clock::name(void) const
+   {  switch( kind_ )
+      {  case tsc_enum:
+         return "tsc";
+         //
+         case raw_enum:
+         return "raw";
+         //
+         default:
+         break;
+      }
+      return "steady";
+   }
+   //
+   // overhead
+   double speed_clock::overhead(void) const
+   {  uint64_t start  = tick();
+      uint64_t n_tick = tick() - start;
+      for(size_t i = 0; i < 1000; ++i)
+      {  uint64_t t_start = tick();
+         uint64_t t_end   = tick();
+         n_tick = std::min(n_tick, t_end - t_start);
+      }
+      return seconds(n_tick);
+   }
+   //
+   // empty_pass
+   double speed_clock::empty_pass(
+      const cmpad::vector< cmpad::vector<double> >& pool   ,
+      size_t&                                       i_pool ,
+      size_t                                        repeat ,
+      bool                                          flush  ) const
+   {  size_t   n_pool  = pool.size();
+      uint64_t t_start = tick();
+      uint64_t n_tick  = 0;
+      for(size_t i = 0; i < repeat; ++i)
+      {  empty_sink = &pool[i_pool];
+         if( ++i_pool == n_pool )
+            i_pool = 0;
+         if( flush )
+         {  uint64_t t_call = tick();
+            n_tick += tick() - t_call;
+         }
+      }
+      uint64_t t_end = tick();
+      if( flush )
+         return seconds(n_tick);
+      return seconds(t_end - t_start);
+   }
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin speed_stat}
+{xrst_spell
+   mad
+}
+
+Statistics for a Set of Timing Samples
+######################################
+
+Prototype
+*********
+{xrst_literal
+   // BEGIN PROTOTYPE
+   // END PROTOTYPE
+}
+
+speed
+*****
+This is a :ref:`speed_result_t-name` object.
+
+time_sample
+===========
+This input value must have at least one element.
+Each element is the seconds for one computation of the function object.
+It is not modified.
+
+Outliers
+========
+A sample is rejected as an outlier if its distance from the median
+is greater than three times 1.4826 times the median absolute deviation
+(for normally distributed samples, 1.4826 times the median absolute deviation
+is an estimate of the standard deviation).
+If the median absolute deviation is zero, no samples are rejected.
+
+Other Fields
+============
+The following fields are set using the samples that are not rejected:
+*rate* ,
+*n_outlier* ,
+*time_median* ,
+*time_mad* ,
+*time_min* ,
+*time_lower* ,
+*time_upper* ,
+*rel_error* .
+The other fields of *speed* are not modified.
+
+Confidence Interval
+===================
+The confidence interval for the median uses the order statistics
+of the samples and does not depend on the distribution of the samples.
+If there are less than nine samples, it is the interval between the
+minimum and maximum sample.
+
+{xrst_toc_hidden
+   cpp/xam/speed_stat.cpp
+}
+Example
+*******
+:ref:`xam_speed_stat.cpp-name` contains an example and test of this routine.
+
+{xrst_end speed_stat}
+------------------------------------------------------------------------------
+*/
+# include <vector>
+# include <cmath>
+# include <cassert>
+# include <algorithm>
+# include <limits>
+# include <cmpad/speed_stat.hpp>
+
+namespace {
+   // sorted_median
+   double sorted_median(const std::vector<double>& sorted)
+   {  size_t n = sorted.size();
+      assert( 0 < n );
+      if( n % 2 == 1 )
+         return sorted[n / 2];
+      return ( sorted[n / 2 - 1] + sorted[n / 2] ) / 2.0;
+   }
+   //
+   // sorted_mad
+   double sorted_mad(const std::vector<double>& sorted, double median)
+   {  size_t n = sorted.size();
+      std::vector<double> deviation(n);
+      for(size_t i = 0; i < n; ++i)
+         deviation[i] = std::fabs( sorted[i] - median );
+      std::sort( deviation.begin(), deviation.end() );
+      return sorted_median(deviation);
+   }
+}
+
+namespace cmpad {
+   // BEGIN PROTOTYPE
+   void speed_stat(speed_result_t& speed)
+   // END PROTOTYPE
+   {  //
+      // n_sample
+      size_t n_sample = speed.time_sample.size();
+      assert( 0 < n_sample );
+      //
+      // sorted
+      std::vector<double> sorted(n_sample);
+      for(size_t i = 0; i < n_sample; ++i)
+         sorted[i] = speed.time_sample[i];
+      std::sort( sorted.begin(), sorted.end() );
+      //
+      // median, mad
+      double median = sorted_median(sorted);
+      double mad    = sorted_mad(sorted, median);
+      //
+      // keep
+      double limit = 3.0 * 1.4826 * mad;
+      std::vector<double> keep;
+      for(size_t i = 0; i < n_sample; ++i)
+      {  if( mad == 0.0 || std::fabs( sorted[i] - median ) <= limit )
+            keep.push_back( sorted[i] );
+      }
+      //
+      // n_outlier
+      size_t n_keep   = keep.size();
+      speed.n_outlier = n_sample - n_keep;
+      //
+      // time_median, time_mad, time_min
+      speed.time_median = sorted_median(keep);
+      speed.time_mad    = sorted_mad(keep, speed.time_median);
+      speed.time_min    = keep[0];
+      //
+      // lower, upper
+      // one based indices of the order statistics for a 95% interval
+      double z     = 1.96;
+      double half  = z * std::sqrt( double(n_keep) ) / 2.0;
+      double lower = std::round( double(n_keep) / 2.0 - half );
+      double upper = std::round( 1.0 + double(n_keep) / 2.0 + half );
+      lower        = std::max(lower, 1.0);
+      upper        = std::min(upper, double(n_keep) );
+      //
+      // time_lower, time_upper
+      speed.time_lower = keep[ size_t(lower) - 1 ];
+      speed.time_upper = keep[ size_t(upper) - 1 ];
+      //
+      // rel_error
+      if( n_keep < 2 )
+         speed.rel_error = std::numeric_limits<double>::quiet_NaN();
+      else
+      {  double sum = 0.0;
+         for(size_t i = 0; i < n_keep; ++i)
+            sum += keep[i];
+         double mean = sum / double(n_keep);
+         double sumsq = 0.0;
+         for(size_t i = 0; i < n_keep; ++i)
+            sumsq += (keep[i] - mean) * (keep[i] - mean);
+         double std_dev  = std::sqrt( sumsq / double(n_keep - 1) );
+         speed.rel_error = std_dev / ( std::sqrt( double(n_keep) ) * mean );
+      }
+      //
+      // rate
+      speed.rate = 1.0 / speed.time_median;
+   }
+}
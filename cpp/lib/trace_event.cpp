@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin trace_event}
+{xrst_spell
+   cat
+   json
+   perfetto
+   pid
+   ph
+   tid
+   ts
+   ui
+}
+
+Record a Timeline of Trace Events
+#################################
+
+Syntax
+******
+| |tab| ``# include <cmpad/trace_event.hpp>``
+| |tab| ``cmpad::trace_event::enable`` ( *on* )
+| |tab| *on* = ``cmpad::trace_event::enabled`` ()
+| |tab| ``cmpad::trace_event::clear`` ()
+| |tab| *n_event* = ``cmpad::trace_event::n_event`` ()
+| |tab| ``cmpad::trace_event::complete`` ( *name* , *cat* , *start* , *end* )
+| |tab| ``cmpad::trace_event::complete`` (
+  *name* , *cat* , *start* , *end* , *arg*
+  )
+| |tab| *ok* = ``cmpad::trace_event::write`` ( *file_name* )
+| |tab| ``cmpad::trace_event`` *span* ( *name* , *cat* )
+| |tab| *span* . ``arg`` ( *key* , *value* )
+| |tab| *span* . ``stop`` ()
+
+Purpose
+*******
+These routines record the spans of time for the phases of a benchmark run;
+e.g., parsing the arguments, each setup phase, each timing pass of
+:ref:`cpp_fun_speed-name` , and reading and writing csv files.
+The spans are written as a Chrome trace event JSON file
+that can be viewed with ``chrome://tracing`` or the Perfetto UI.
+One timeline makes it easy to see where a setup heavy package spends its
+time and if some of the timing passes were interrupted.
+
+Enabled
+*******
+The events are stored in a static object that is shared by all threads.
+Events are only recorded when *on* is true (the initial value is false).
+When it is false, constructing and stopping a *span* only checks *on* ;
+i.e., it does not read the clock or record an event.
+Recording an event is thread safe and each event records the thread
+that it was recorded by.
+
+clear
+*****
+This routine removes all of the recorded events.
+
+n_event
+*******
+This ``size_t`` is the number of events that have been recorded.
+
+name
+****
+This ``const char*`` is the name for the event.
+It is copied when the event is recorded.
+
+cat
+***
+This ``const char*`` is the category for the event; e.g.,
+``fun_speed`` , ``phase`` , or ``csv`` .
+The viewers can filter the events by category.
+
+complete
+********
+If recording is enabled,
+this routine records an event that starts at *start* and ends at *end* .
+These have type ``cmpad::trace_event::time_point`` ,
+which is a ``std::chrono::steady_clock::time_point`` .
+This can be used to record a span that started before recording was enabled;
+e.g., the time to parse the arguments that determine if recording is enabled.
+
+arg
+***
+This ``const std::string&`` is a comma separated list of
+JSON ``"``\ *key*\ ``":``\ *value* pairs that are displayed with the event.
+If it is not present, the event has no arguments.
+
+span
+****
+If recording is enabled, the constructor starts a span.
+The span is recorded when ``stop`` is called or when *span*
+is destroyed, which ever comes first.
+Spans may be nested; e.g., a timing pass is nested in a call to fun_speed.
+The ``const char*`` values *name* and *cat* must be valid for the
+lifetime of *span* .
+
+key
+===
+This ``const char*`` is the name for an argument of the span.
+
+value
+=====
+This ``double`` is the value for the argument.
+If ``arg`` is called when the span is not running, it has no effect.
+
+write
+*****
+This routine writes all the recorded events to the file *file_name* ,
+replacing its previous contents.
+The return value *ok* is false if the file could not be written.
+
+File Format
+***********
+The file contains a JSON object with a ``traceEvents`` array.
+Each event is a complete event; i.e., its ``ph`` field is ``X`` .
+Its ``ts`` and ``dur`` fields are the start and duration in microseconds,
+where ``ts`` is relative to the time this library was loaded.
+Its ``pid`` and ``tid`` fields are the process and thread ids.
+On systems other than Linux, the thread id is a hash code for the
+``std::thread::id`` of the thread, and on systems other than Unix,
+the process id is zero.
+The array also contains metadata events that name the process ``cmpad``
+and each thread that recorded an event.
+
+{xrst_toc_hidden
+   cpp/xam/trace_event.cpp
+}
+Example
+*******
+:ref:`xam_trace_event.cpp-name` contains an example and test of this class.
+
+{xrst_end trace_event}
+------------------------------------------------------------------------------
+*/
+# include <cmath>
+# include <cstdio>
+# include <fstream>
+# include <mutex>
+# include <vector>
+# include <thread>
+# include <algorithm>
+# include <functional>
+# include <cmpad/trace_event.hpp>
+
+# if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+# endif
+# ifdef __linux__
+# include <sys/syscall.h>
+# endif
+
+namespace {
+   // thread_id
+   // the Linux thread id, or a hash code for the C++ thread id
+   long thread_id(void)
+   {
+# ifdef __linux__
+      return long( syscall(SYS_gettid) );
+# else
+      size_t code = std::hash<std::thread::id>()( std::this_thread::get_id() );
+      return long( code & 0x7fffffff );
+# endif
+   }
+   //
+   // process_id
+   long process_id(void)
+   {
+# if defined(__unix__) || defined(__APPLE__)
+      return long( getpid() );
+# else
+      return 0;
+# endif
+   }
+   //
+   // main_tid_
+   // the static initialization is done by the main thread
+   const long main_tid_ = thread_id();
+   //
+   // event_t
+   struct event_t {
+      std::string name;
+      std::string cat;
+      std::string arg;
+      double      ts;
+      double      dur;
+      long        tid;
+   };
+   //
+   // enabled_
+   bool enabled_ = false;
+   //
+   // mutex_
+   std::mutex mutex_;
+   //
+   // event_vec_
+   std::vector<event_t> event_vec_;
+   //
+   // origin_
+   // time that this library was loaded
+   const cmpad::trace_event::time_point origin_ =
+      std::chrono::steady_clock::now();
+   //
+   // micro_second
+   double micro_second(cmpad::trace_event::time_point t)
+   {  return std::chrono::duration<double, std::micro>(t - origin_).count(); }
+   //
+   // json_string
+   std::string json_string(const std::string& str)
+   {  std::string result = "\"";
+      for(char ch : str)
+      {  if( ch == '"' || ch == '\\' )
+         {  result += '\\';
+            result += ch;
+         }
+         else if( (unsigned char)(ch) < 0x20 )
+            result += ' ';
+         else
+            result += ch;
+      }
+      result += '"';
+      return result;
+   }
+   //
+   // json_number
+   std::string json_number(double value, const char* format)
+   {  if( ! std::isfinite(value) )
+         return "null";
+      char buffer[64];
+      std::snprintf(buffer, sizeof(buffer), format, value);
+      return buffer;
+   }
+}
+
+namespace cmpad {
+   // enable
+   void trace_event::enable(bool on)
+   {  enabled_ = on; }
+   //
+   // enabled
+   bool trace_event::enabled(void)
+   {  return enabled_; }
+   //
+   // clear
+   void trace_event::clear(void)
+   {  std::lock_guard<std::mutex> lock(mutex_);
+      event_vec_.clear();
+   }
+   //
+   // n_event
+   size_t trace_event::n_event(void)
+   {  std::lock_guard<std::mutex> lock(mutex_);
+      return event_vec_.size();
+   }
+   //
+   // complete
+   void trace_event::complete(
+      const char*        name  ,
+      const char*        cat   ,
+      time_point         start ,
+      time_point         end   ,
+      const std::string& arg   )
+   {  if( ! enabled_ )
+         return;
+      //
+      // event
+      event_t event;
+      event.name = name;
+      event.cat  = cat;
+      event.arg  = arg;
+      event.ts   = micro_second(start);
+      event.dur  = micro_second(end) - event.ts;
+      event.tid  = thread_id();
+      //
+      // event_vec_
+      std::lock_guard<std::mutex> lock(mutex_);
+      event_vec_.push_back(event);
+   }
+   //
+   // write
+   bool trace_event::write(const std::string& file_name)
+   {  std::lock_guard<std::mutex> lock(mutex_);
+      //
+      // file
+      std::ofstream file(file_name);
+      if( ! file )
+         return false;
+      //
+      // pid
+      long pid = process_id();
+      //
+      // tid_vec
+      // threads that recorded an event, main thread first
+      std::vector<long> tid_vec;
+      tid_vec.push_back(main_tid_);
+      for(const event_t& event : event_vec_)
+      {  if( std::find(tid_vec.begin(), tid_vec.end(), event.tid)
+            == tid_vec.end() )
+            tid_vec.push_back(event.tid);
+      }
+      //
+      // metadata events
+      file << "{\"traceEvents\":[\n";
+      file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+           << ",\"tid\":" << main_tid_
+           << ",\"args\":{\"name\":\"cmpad\"}}";
+      for(size_t k = 0; k < tid_vec.size(); ++k)
+      {  std::string thread = "main";
+         if( k > 0 )
+            thread = "thread_" + std::to_string(k);
+         file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+              << ",\"tid\":" << tid_vec[k]
+              << ",\"args\":{\"name\":" << json_string(thread) << "}}";
+      }
+      //
+      // complete events
+      for(const event_t& event : event_vec_)
+      {  file << ",\n{\"name\":" << json_string(event.name)
+              << ",\"cat\":"    << json_string(event.cat)
+              << ",\"ph\":\"X\""
+              << ",\"ts\":"     << json_number(event.ts, "%.3f")
+              << ",\"dur\":"    << json_number(event.dur, "%.3f")
+              << ",\"pid\":"    << pid
+              << ",\"tid\":"    << event.tid;
+         if( event.arg != "" )
+            file << ",\"args\":{" << event.arg << "}";
+         file << "}";
+      }
+      file << "\n],\"displayTimeUnit\":\"ns\"}\n";
+      //
+      file.close();
+      return bool(file);
+   }
+   //
+   // constructor
+   trace_event::trace_event(const char* name, const char* cat)
+   {  name_    = name;
+      cat_     = cat;
+      running_ = enabled_;
+      if( running_ )
+         start_ = std::chrono::steady_clock::now();
+   }
+   //
+   // destructor
+   trace_event::~trace_event(void)
+   {  stop(); }
+   //
+   // arg
+   void trace_event::arg(const char* key, double value)
+   {  if( ! running_ )
+         return;
+      if( arg_ != "" )
+         arg_ += ',';
+      arg_ += json_string(key) + ':' + json_number(value, "%.17g");
+   }
+   //
+   // stop
+   void trace_event::stop(void)
+   {  if( ! running_ )
+         return;
+      running_ = false;
+      time_point end = std::chrono::steady_clock::now();
+      complete(name_, cat_, start_, end, arg_);
+   }
+}
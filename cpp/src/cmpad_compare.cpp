@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin cmpad_compare}
+{xrst_spell
+   cand
+}
+
+Detect Speed Regressions Between Two Results Files
+##################################################
+
+Syntax
+******
+| |tab| ``cpp/build/src/cmpad_compare`` *arguments*
+
+Purpose
+*******
+This program compares the timings in a baseline results file with the
+timings in a candidate results file
+(both written by :ref:`run_cmpad-name` ).
+It uses a :ref:`mann_whitney-name` test for each case so that the
+noise in the timings is not reported as a change in speed.
+
+Arguments
+*********
+All of the arguments below have a default value that is used
+when the argument is not present.
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   short version, long version, default
+   ``-b``  *baseline*  , ``--baseline``  *baseline*  , baseline.csv
+   ``-c``  *candidate* , ``--candidate`` *candidate* , cmpad.csv
+   ``-a``  *alpha*     , ``--alpha``     *alpha*     , 0.05
+   ``-t``  *threshold* , ``--threshold`` *threshold* , 0.05
+   ``-h``              , ``--help``                  , false
+
+baseline, candidate
+===================
+These are the :ref:`csv_column-name` files for the baseline
+and candidate versions.
+
+alpha
+=====
+A change in speed is significant if its
+:ref:`mann_whitney@result@p_value` is less than *alpha* .
+The speedup interval in the output is a 1 - *alpha* confidence interval.
+
+threshold
+=========
+A significant slowdown is a regression if the candidate takes more than
+1 + *threshold* times as long as the baseline.
+
+help
+====
+If this argument is present, print a usage message and exit.
+
+Cases
+*****
+The rows in each file are grouped by the
+package, algorithm, n_arg, n_other, time_setup, special, and flush_cache
+columns and the samples for each case are determined by
+:ref:`case_sample-name` .
+
+Output
+******
+One line is printed for each case with the following columns
+(in addition to the case columns):
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   column, meaning
+   n_base,  number of baseline samples
+   n_cand,  number of candidate samples
+   speedup, baseline time divided by candidate time
+   lower,   lower limit of the speedup confidence interval
+   upper,   upper limit of the speedup confidence interval
+   p_value, p-value for the hypothesis that there is no change
+   status,  ``same`` ``faster`` ``slower`` or ``regression``
+
+A case that is only in one of the files has status ``baseline_only`` or
+``candidate_only`` and is not compared.
+
+Exit Status
+***********
+The exit status is zero if there is no regression,
+one if there is a regression, and two if there is an error.
+
+Example
+*******
+::
+
+   bin/run_cmpad.sh -p cppad -a det_by_minor -s 20 -f baseline.csv
+   # change cmpad or the package
+   bin/run_cmpad.sh -p cppad -a det_by_minor -s 20 -f cmpad.csv
+   cmpad_compare -b baseline.csv -c cmpad.csv
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cmpad_compare}
+*/
+// BEGIN C++
+# include <cstdlib>
+# include <algorithm>
+# include <iomanip>
+# include <iostream>
+# include <sstream>
+# include <getopt.h>
+# include <cmpad/case_sample.hpp>
+# include <cmpad/mann_whitney.hpp>
+
+namespace {
+   //
+   // fixed2string, sci2string
+   std::string fixed2string(double value)
+   {  std::stringstream ss;
+      ss << std::setprecision(3) << std::fixed << value;
+      return ss.str();
+   }
+   std::string sci2string(double value)
+   {  std::stringstream ss;
+      ss << std::setprecision(1) << std::scientific << value;
+      return ss.str();
+   }
+}
+
+int main(int argc, char* argv[])
+{  //
+   // baseline, candidate, alpha, threshold
+   std::string baseline  = "baseline.csv";
+   std::string candidate = "cmpad.csv";
+   double      alpha     = 0.05;
+   double      threshold = 0.05;
+   //
+   // long_options
+   struct option long_options[] =
+   {  // name,         has_arg,            *flag,            val
+      { "alpha",       required_argument,  0,                'a' },
+      { "baseline",    required_argument,  0,                'b' },
+      { "candidate",   required_argument,  0,                'c' },
+      { "threshold",   required_argument,  0,                't' },
+      // flags
+      { "help",        no_argument,        0,                'h' },
+      {0,              0,                  0,                 0  }
+   };
+   //
+   // shortopts
+   const char* shortopts = "a:b:c:t:" "h";
+   //
+   // error_msg, help
+   std::string error_msg = "";
+   bool        help      = false;
+   //
+   // option
+   int option_index = 0;
+   int option = getopt_long(argc, argv, shortopts, long_options, &option_index);
+   while( option != -1 && error_msg == "" )
+   {  switch( option )
+      {  //
+         // alpha
+         case 'a':
+         alpha = std::atof( optarg );
+         if( ! (0.0 < alpha && alpha < 1.0) )
+            error_msg = "cmpad_compare: alpha is not between zero and one";
+         break;
+         //
+         // baseline
+         case 'b':
+         baseline = optarg;
+         break;
+         //
+         // candidate
+         case 'c':
+         candidate = optarg;
+         break;
+         //
+         // threshold
+         case 't':
+         threshold = std::atof( optarg );
+         if( ! (0.0 <= threshold) )
+            error_msg = "cmpad_compare: threshold is negative";
+         break;
+         //
+         // help
+         case 'h':
+         help = true;
+         break;
+         //
+         // ?
+         default:
+         error_msg = "cmpad_compare: exiting due to option error";
+         break;
+      }
+      option = getopt_long(argc, argv, shortopts, long_options, &option_index);
+   }
+   if( error_msg == "" && optind < argc )
+      error_msg = std::string("cmpad_compare: unexpected argument ") + argv[optind];
+   if( error_msg != "" )
+   {  std::cerr << error_msg << "\n";
+      return 2;
+   }
+   if( help )
+   {  const char* usage =
+         "usage: cmpad_compare [options]\n"
+         "-b: --baseline:  string: "
+            "csv file with the baseline results [baseline.csv]\n"
+         "-c: --candidate: string: "
+            "csv file with the candidate results [cmpad.csv]\n"
+         "-a: --alpha:     double: "
+            "significance level for the Mann-Whitney test [0.05]\n"
+         "-t: --threshold: double: "
+            "relative slowdown that is a regression [0.05]\n"
+         "-h: --help:            : "
+            "if present, print this message and halt [false]\n"
+         "\nValues between '[' and ']' above are defaults.\n"
+         "\nexit status: 0 no regression, 1 regression, 2 error\n";
+      std::cout << usage;
+      return 0;
+   }
+   //
+   // base_sample, base_order, cand_sample, cand_order
+   cmpad::case_sample_t             base_sample, cand_sample;
+   cmpad::vector<cmpad::case_key_t> base_order,  cand_order;
+   std::string msg = cmpad::case_sample(baseline, base_sample, base_order);
+   if( msg == "" )
+      msg = cmpad::case_sample(candidate, cand_sample, cand_order);
+   if( msg != "" )
+   {  std::cerr << "cmpad_compare: " << msg << "\n";
+      return 2;
+   }
+   //
+   // order
+   cmpad::vector<cmpad::case_key_t> order = base_order;
+   for(size_t i = 0; i < cand_order.size(); ++i)
+   {  if( base_sample.find( cand_order[i] ) == base_sample.end() )
+         order.push_back( cand_order[i] );
+   }
+   //
+   // table
+   cmpad::vector< cmpad::vector<std::string> > table;
+   cmpad::vector<std::string> header = cmpad::case_key_name();
+   for(const char* name : {
+      "n_base", "n_cand", "speedup", "lower", "upper", "p_value", "status"
+   } )
+      header.push_back( name );
+   table.push_back( header );
+   //
+   // table, regression
+   bool regression = false;
+   for(size_t i = 0; i < order.size(); ++i)
+   {  const cmpad::case_key_t& key = order[i];
+      cmpad::vector<std::string> line = key;
+      //
+      // base, cand
+      cmpad::vector<double> empty;
+      auto base_itr = base_sample.find(key);
+      auto cand_itr = cand_sample.find(key);
+      const cmpad::vector<double>& base =
+         base_itr == base_sample.end() ? empty : base_itr->second;
+      const cmpad::vector<double>& cand =
+         cand_itr == cand_sample.end() ? empty : cand_itr->second;
+      line.push_back( std::to_string( base.size() ) );
+      line.push_back( std::to_string( cand.size() ) );
+      //
+      if( base.size() == 0 || cand.size() == 0 )
+      {  for(size_t j = 0; j < 4; ++j)
+            line.push_back( "" );
+         if( base.size() == 0 )
+            line.push_back( "candidate_only" );
+         else
+            line.push_back( "baseline_only" );
+      }
+      else
+      {  cmpad::mann_whitney_t result = cmpad::mann_whitney(base, cand, alpha);
+         line.push_back( fixed2string( result.speedup ) );
+         line.push_back( fixed2string( result.speedup_lower ) );
+         line.push_back( fixed2string( result.speedup_upper ) );
+         line.push_back( sci2string( result.p_value ) );
+         //
+         // status
+         std::string status = "same";
+         if( result.p_value < alpha )
+         {  if( result.speedup < 1.0 / (1.0 + threshold) )
+            {  status     = "regression";
+               regression = true;
+            }
+            else if( result.speedup < 1.0 )
+               status = "slower";
+            else
+               status = "faster";
+         }
+         line.push_back( status );
+      }
+      table.push_back( line );
+   }
+   //
+   // width
+   cmpad::vector<size_t> width( table[0].size(), 0 );
+   for(size_t i = 0; i < table.size(); ++i)
+   {  for(size_t j = 0; j < table[i].size(); ++j)
+         width[j] = std::max( width[j], table[i][j].size() );
+   }
+   //
+   // std::cout
+   for(size_t i = 0; i < table.size(); ++i)
+   {  for(size_t j = 0; j < table[i].size(); ++j)
+      {  if( j == 0 )
+            std::cout << std::left << std::setw( int(width[j]) );
+         else
+            std::cout << "  " << std::right << std::setw( int(width[j]) );
+         std::cout << table[i][j];
+      }
+      std::cout << '\n';
+   }
+   if( regression )
+      return 1;
+   return 0;
+}
+// END C++
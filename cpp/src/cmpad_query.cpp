@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin cmpad_query}
+{xrst_spell
+   codi
+}
+
+Query and Aggregate the cmpad Results
+#####################################
+
+Syntax
+******
+| |tab| ``cpp/build/src/cmpad_query`` *arguments*
+
+Purpose
+*******
+This program filters, groups, and aggregates the rows of a results file
+without using python. It streams the file, so it is fast even for
+a large history of results; see :ref:`results_query-name` .
+
+Arguments
+*********
+All of the arguments below have a default value that is used
+when the argument is not present.
+
+.. csv-table::
+   :widths: auto
+   :header-rows: 1
+
+   short version, long version, default, query_t field
+   ``-f``  *source* , ``--file_name`` *source* , cmpad.csv, *source*
+   ``-w``  *where*  , ``--where``     *where*  , empty , *where*
+   ``-d``  *days*   , ``--days``      *days*   , 0     , *days*
+   ``-g``  *group*  , ``--group``     *group*  , empty , *group*
+   ``-v``  *value*  , ``--value``     *value*  , rate  , *value*
+   ``-s``  *stat*   , ``--stat``      *stat*   , median, *stat*
+   ``-p``  *pivot*  , ``--pivot``     *pivot*  , empty , *pivot_row* , *pivot_col*
+   ``-b``  *base*   , ``--base``      *base*   , empty , *base*
+   ``-c``           , ``--csv``                , false ,
+   ``-h``           , ``--help``               , false ,
+
+The last column is the corresponding :ref:`results_query@query`
+field; e.g., *source* is a csv file or a :ref:`results_store-name`
+directory.
+
+where
+=====
+This argument can be used more than once and a row must satisfy
+all of the conditions.
+
+group
+=====
+This is a comma separated list of column names.
+
+pivot
+=====
+This is the two column names *pivot_row* , *pivot_col*
+separated by a comma.
+
+csv
+===
+If this argument is present, the result is printed in csv format.
+Otherwise the columns are aligned for reading.
+
+help
+====
+If this argument is present, print a usage message and exit.
+
+Examples
+********
+The best rate per package for an_ode over the last 30 days::
+
+   cmpad_query -f cmpad.csv -w algorithm=an_ode -d 30 -g package -s max
+
+The speedup of codi over cppad for each n_arg
+(using the median rate for each package and size)::
+
+   cmpad_query -w algorithm=det_by_minor -p package,n_arg -b cppad
+
+Source Code
+***********
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end cmpad_query}
+*/
+// BEGIN C++
+# include <cstdlib>
+# include <algorithm>
+# include <iomanip>
+# include <iostream>
+# include <getopt.h>
+# include <cmpad/results_query.hpp>
+# include <cmpad/csv_write.hpp>
+
+namespace {
+   // split
+   cmpad::vector<std::string> split(const std::string& list)
+   {  cmpad::vector<std::string> result;
+      size_t previous = 0;
+      size_t next     = list.find(',', previous);
+      while( next != std::string::npos )
+      {  result.push_back( list.substr(previous, next - previous) );
+         previous = next + 1;
+         next     = list.find(',', previous);
+      }
+      result.push_back( list.substr(previous) );
+      return result;
+   }
+}
+
+int main(int argc, char* argv[])
+{  //
+   // source, query, csv
+   std::string    source = "cmpad.csv";
+   cmpad::query_t query;
+   bool           csv    = false;
+   //
+   // long_options
+   struct option long_options[] =
+   {  // name,         has_arg,            *flag,            val
+      { "base",        required_argument,  0,                'b' },
+      { "days",        required_argument,  0,                'd' },
+      { "file_name",   required_argument,  0,                'f' },
+      { "group",       required_argument,  0,                'g' },
+      { "pivot",       required_argument,  0,                'p' },
+      { "stat",        required_argument,  0,                's' },
+      { "value",       required_argument,  0,                'v' },
+      { "where",       required_argument,  0,                'w' },
+      // flags
+      { "csv",         no_argument,        0,                'c' },
+      { "help",        no_argument,        0,                'h' },
+      {0,              0,                  0,                 0  }
+   };
+   //
+   // shortopts
+   const char* shortopts = "b:d:f:g:p:s:v:w:" "ch";
+   //
+   // error_msg, help
+   std::string error_msg = "";
+   bool        help      = false;
+   //
+   // option
+   int option_index = 0;
+   int option = getopt_long(argc, argv, shortopts, long_options, &option_index);
+   while( option != -1 && error_msg == "" )
+   {  switch( option )
+      {  //
+         // base
+         case 'b':
+         query.base = optarg;
+         break;
+         //
+         // days
+         case 'd':
+         query.days = size_t( std::atol( optarg ) );
+         break;
+         //
+         // file_name
+         case 'f':
+         source = optarg;
+         break;
+         //
+         // group
+         case 'g':
+         query.group = split( optarg );
+         break;
+         //
+         // pivot
+         case 'p':
+         {  cmpad::vector<std::string> pivot = split( optarg );
+            if( pivot.size() != 2 )
+               error_msg = "cmpad_query: pivot is not row,col";
+            else
+            {  query.pivot_row = pivot[0];
+               query.pivot_col = pivot[1];
+            }
+         }
+         break;
+         //
+         // stat
+         case 's':
+         query.stat = optarg;
+         break;
+         //
+         // value
+         case 'v':
+         query.value = optarg;
+         break;
+         //
+         // where
+         case 'w':
+         query.where.push_back( optarg );
+         break;
+         //
+         // csv
+         case 'c':
+         csv = true;
+         break;
+         //
+         // help
+         case 'h':
+         help = true;
+         break;
+         //
+         // ?
+         default:
+         error_msg = "cmpad_query: exiting due to option error";
+         break;
+      }
+      option = getopt_long(argc, argv, shortopts, long_options, &option_index);
+   }
+   if( error_msg == "" && optind < argc )
+      error_msg = std::string("cmpad_query: unexpected argument ") + argv[optind];
+   if( error_msg != "" )
+   {  std::cerr << error_msg << "\n";
+      return 1;
+   }
+   if( help )
+   {  const char* usage =
+         "usage: cmpad_query [options]\n"
+         "-f: --file_name: string: "
+            "csv file or results store directory [cmpad.csv]\n"
+         "-w: --where:     string: "
+            "condition name op value, op is = != < <= > >= []\n"
+         "-d: --days:      size_t: "
+            "only use rows from the last days days, 0 for all [0]\n"
+         "-g: --group:     string: "
+            "comma separated columns that define the groups []\n"
+         "-v: --value:     string: "
+            "column that is aggregated [rate]\n"
+         "-s: --stat:      string: "
+            "min, median, max, mean, or count [median]\n"
+         "-p: --pivot:     string: "
+            "row,col columns for a pivot table []\n"
+         "-b: --base:      string: "
+            "divide each pivot cell by the cell in this row []\n"
+         "-c: --csv:             : "
+            "if present, print the result in csv format [false]\n"
+         "-h: --help:            : "
+            "if present, print this message and halt [false]\n"
+         "\nValues between '[' and ']' above are defaults.\n";
+      std::cout << usage;
+      return 0;
+   }
+   //
+   // table
+   cmpad::vec_vec_str table;
+   std::string msg = cmpad::results_query(source, query, table);
+   if( msg != "" )
+   {  std::cerr << "cmpad_query: " << msg << "\n";
+      return 1;
+   }
+   //
+   // csv
+   if( csv )
+   {  for(size_t i = 0; i < table.size(); ++i)
+      {  for(size_t j = 0; j < table[i].size(); ++j)
+         {  if( j > 0 )
+               std::cout << ',';
+            std::cout << cmpad::csv_field( table[i][j] );
+         }
+         std::cout << '\n';
+      }
+      return 0;
+   }
+   //
+   // width
+   cmpad::vector<size_t> width( table[0].size(), 0 );
+   for(size_t i = 0; i < table.size(); ++i)
+   {  for(size_t j = 0; j < table[i].size(); ++j)
+         width[j] = std::max( width[j], table[i][j].size() );
+   }
+   //
+   // std::cout
+   for(size_t i = 0; i < table.size(); ++i)
+   {  for(size_t j = 0; j < table[i].size(); ++j)
+      {  if( j == 0 )
+            std::cout << std::left << std::setw( int(width[j]) );
+         else
+            std::cout << "  " << std::right << std::setw( int(width[j]) );
+         std::cout << table[i][j];
+      }
+      std::cout << '\n';
+   }
+   return 0;
+}
+// END C++
@@ -35,6 +35,25 @@ arguments_t
    n_arg,       see :ref:`run_cmpad@n_arg`
    n_other,     see :ref:`run_cmpad@n_other`
    time_setup,  see :ref:`run_cmpad@time_setup`
+   n_sample,    see :ref:`run_cmpad@n_sample`
+   n_warmup,    see :ref:`run_cmpad@n_warmup`
+   n_pool,      see :ref:`run_cmpad@n_pool`
+   perf_counter, see :ref:`run_cmpad@perf_counter`
+   latency_file, see :ref:`run_cmpad@latency_file`
+   clock,       see :ref:`run_cmpad@clock`
+   rel_error,   see :ref:`run_cmpad@rel_error`
+   max_time,    see :ref:`run_cmpad@max_time`
+   compare,     see :ref:`run_cmpad@compare`
+   cpu,         see :ref:`run_cmpad@cpu`
+   refuse_noisy, see :ref:`run_cmpad@refuse_noisy`
+   cold_file,   see :ref:`run_cmpad@cold_file`
+   flush_cache, see :ref:`run_cmpad@flush_cache`
+   perf_map,    see :ref:`run_cmpad@perf_map`
+   trace_file,  see :ref:`run_cmpad@trace_file`
+   profile,     see :ref:`run_cmpad@profile`
+   peak_gflops, see :ref:`run_cmpad@peak_gflops`
+   fsync,       see :ref:`run_cmpad@fsync`
+   store_dir,   see :ref:`run_cmpad@store_dir`
 
 {xrst_end parse_args}
 */
@@ -58,27 +77,65 @@ arguments_t parse_args(int argc, char* argv[])
    arguments.n_other    = 0;
    arguments.package    = "none";
    arguments.time_setup = false;
+   arguments.n_sample   = 1;
+   arguments.n_warmup   = 0;
+   arguments.n_pool     = 16;
+   arguments.perf_counter = false;
+   arguments.latency_file = "";
+   arguments.clock      = "steady";
+   arguments.rel_error  = 0.0;
+   arguments.max_time   = 10.0;
+   arguments.compare    = "";
+   arguments.cpu        = -1;
+   arguments.refuse_noisy = false;
+   arguments.cold_file  = "";
+   arguments.flush_cache = false;
+   arguments.perf_map   = false;
+   arguments.trace_file = "";
+   arguments.profile    = false;
+   arguments.peak_gflops = 0.0;
+   arguments.fsync      = false;
+   arguments.store_dir  = "";
    // END DEFAULT ARGUMENTS
    //
    // long_options
    struct option long_options[] =
    {  // name,         has_arg,            *flag,            val
       { "algorithm",   required_argument,  0,                'a' },
+      { "compare",     required_argument,  0,                'b' },
+      { "cold_file",   required_argument,  0,                'd' },
+      { "rel_error",   required_argument,  0,                'e' },
       { "file_name",   required_argument,  0,                'f' },
+      { "n_pool",      required_argument,  0,                'i' },
+      { "clock",       required_argument,  0,                'k' },
+      { "latency_file", required_argument, 0,                'l' },
       { "min_time",    required_argument,  0,                'm' },
       { "n_arg",       required_argument,  0,                'n' },
       { "n_other",     required_argument,  0,                'o' },
       { "package",     required_argument,  0,                'p' },
+      { "n_sample",    required_argument,  0,                's' },
+      { "cpu",         required_argument,  0,                'u' },
+      { "n_warmup",    required_argument,  0,                'w' },
+      { "max_time",    required_argument,  0,                'x' },
+      { "trace_file",  required_argument,  0,                'y' },
+      { "peak_gflops", required_argument,  0,                'z' },
+      { "store_dir",   required_argument,  0,                'S' },
       // flags
       { "version",     no_argument,        0,                'v' },
       { "help",        no_argument,        0,                'h' },
       { "time_setup",  no_argument,        0,                't' },
+      { "perf_counter", no_argument,       0,                'c' },
+      { "refuse_noisy", no_argument,       0,                'r' },
+      { "flush_cache", no_argument,        0,                'g' },
+      { "perf_map",    no_argument,        0,                'j' },
+      { "profile",     no_argument,        0,                'q' },
+      { "fsync",       no_argument,        0,                'F' },
       {0,              0,                  0,                 0  }
    };
    //
    // shortopts
    // one : means argument requires after the option
-   const char* shortopts = "a:f:m:n:o:p:" "vht";
+   const char* shortopts = "a:b:d:e:f:i:k:l:m:n:o:p:s:u:w:x:y:z:S:" "vhtcrgjqF";
    //
    // error_msg
    std::string error_msg = "";
@@ -114,11 +171,41 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.algorithm = optarg;
          break;
          //
+         // compare
+         case 'b':
+         arguments.compare = optarg;
+         break;
+         //
+         // cold_file
+         case 'd':
+         arguments.cold_file = optarg;
+         break;
+         //
+         // rel_error
+         case 'e':
+         arguments.rel_error = std::atof( optarg );
+         break;
+         //
          // file_name
          case 'f':
          arguments.file_name = optarg;
          break;
          //
+         // n_pool
+         case 'i':
+         arguments.n_pool = size_t( std::atoi( optarg ) );
+         break;
+         //
+         // clock
+         case 'k':
+         arguments.clock = optarg;
+         break;
+         //
+         // latency_file
+         case 'l':
+         arguments.latency_file = optarg;
+         break;
+         //
          // min_time
          case 'm':
          arguments.min_time = std::atof( optarg );
@@ -139,6 +226,41 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.package = optarg;
          break;
          //
+         // n_sample
+         case 's':
+         arguments.n_sample = size_t( std::atoi( optarg ) );
+         break;
+         //
+         // cpu
+         case 'u':
+         arguments.cpu = std::atoi( optarg );
+         break;
+         //
+         // n_warmup
+         case 'w':
+         arguments.n_warmup = size_t( std::atoi( optarg ) );
+         break;
+         //
+         // max_time
+         case 'x':
+         arguments.max_time = std::atof( optarg );
+         break;
+         //
+         // trace_file
+         case 'y':
+         arguments.trace_file = optarg;
+         break;
+         //
+         // peak_gflops
+         case 'z':
+         arguments.peak_gflops = std::atof( optarg );
+         break;
+         //
+         // store_dir
+         case 'S':
+         arguments.store_dir = optarg;
+         break;
+         //
          // version
          case 'v':
          version = true;
@@ -154,6 +276,36 @@ arguments_t parse_args(int argc, char* argv[])
          arguments.time_setup = true;
          break;
          //
+         // perf_counter
+         case 'c':
+         arguments.perf_counter = true;
+         break;
+         //
+         // refuse_noisy
+         case 'r':
+         arguments.refuse_noisy = true;
+         break;
+         //
+         // flush_cache
+         case 'g':
+         arguments.flush_cache = true;
+         break;
+         //
+         // perf_map
+         case 'j':
+         arguments.perf_map = true;
+         break;
+         //
+         // profile
+         case 'q':
+         arguments.profile = true;
+         break;
+         //
+         // fsync
+         case 'F':
+         arguments.fsync = true;
+         break;
+         //
          // ?
          case '?':
          error_msg  = "cmpad: exiting due to option error";
@@ -173,8 +325,20 @@ arguments_t parse_args(int argc, char* argv[])
          "cmpad: Compare C++ AD packages\n\n"
          "-a: --algorithm:  string: "
             "is det_by_minor, an_ode or llsq_obj [det_by_minor]\n"
+         "-b: --compare:    string: "
+            "comma separated packages to compare in one process []\n"
+         "-d: --cold_file:  string: "
+            "csv file that the time to the first result is added to []\n"
+         "-e: --rel_error:  double: "
+            "target relative standard error, zero for n_sample samples [0]\n"
          "-f: --file_name:  string: "
             "csv file that line is added to [cmpad.csv]\n"
+         "-i: --n_pool:     size_t: "
+            "number of argument vectors in the input pool [16]\n"
+         "-k: --clock:      string: "
+            "is steady, tsc, or raw [steady]\n"
+         "-l: --latency_file: string: "
+            "csv file that latency histograms are added to []\n"
          "-m: --min_time:   double: "
             "minimum time in seconds to average computation rate [0.5]\n"
          "-n: --n_arg:      size_t: "
@@ -183,8 +347,34 @@ arguments_t parse_args(int argc, char* argv[])
             "The meaning opf this integer is algorithm specific [0]\n"
          "-p: --package:    string: "
             "none or an AD packae name [none]\n"
+         "-s: --n_sample:   size_t: "
+            "number of timing samples [1]\n"
+         "-u: --cpu:        int:    "
+            "index of the core to pin the timing to, -1 for none [-1]\n"
+         "-w: --n_warmup:   size_t: "
+            "number of warm-up passes before the samples [0]\n"
+         "-x: --max_time:   double: "
+            "time budget in seconds for the samples when rel_error > 0 [10]\n"
+         "-y: --trace_file: string: "
+            "Chrome trace event json file for the timeline of this run []\n"
+         "-z: --peak_gflops: double: "
+            "peak GFLOP/s of the machine, zero for no efficiency column [0]\n"
+         "-S: --store_dir:  string: "
+            "directory for a binary copy of the file_name rows []\n"
          "-t: --time_setup:       : "
             "if present, include setup time in speed [false]\n"
+         "-c: --perf_counter:     : "
+            "if present, count hardware events during timing [false]\n"
+         "-r: --refuse_noisy:     : "
+            "if present, exit when the environment is noisy [false]\n"
+         "-g: --flush_cache:      : "
+            "if present, flush the caches before each computation [false]\n"
+         "-j: --perf_map:         : "
+            "if present, add jit functions to /tmp/perf-<pid>.map [false]\n"
+         "-q: --profile:          : "
+            "if present, print a sampling profile of the timing [false]\n"
+         "-F: --fsync:            : "
+            "if present, fsync the csv files after each row [false]\n"
          "-v: --version:          : "
             "if present, print the cmpad version number and halt [false]\n"
          "-h: --help:             : "
@@ -17,6 +17,25 @@ struct arguments_t
    std::string  package;
    size_t       n_arg;
    bool         time_setup;
+   size_t       n_sample;
+   size_t       n_warmup;
+   size_t       n_pool;
+   bool         perf_counter;
+   std::string  latency_file;
+   std::string  clock;
+   double       rel_error;
+   double       max_time;
+   std::string  compare;
+   int          cpu;
+   bool         refuse_noisy;
+   std::string  cold_file;
+   bool         flush_cache;
+   bool         perf_map;
+   std::string  trace_file;
+   bool         profile;
+   double       peak_gflops;
+   bool         fsync;
+   std::string  store_dir;
 };
 // END ARGUMENTS_T
 
@@ -36,14 +36,33 @@ Source Code
 
 // std namespace
 # include <algorithm>
+# include <memory>
+# include <sstream>
 # include <string>
 # include <iostream>
+# include <cassert>
 
 // cmpad utilities
 # include <cmpad/vector.hpp>
 # include <cmpad/option_t.hpp>
+# include <cmpad/speed_option_t.hpp>
+# include <cmpad/perf_counter.hpp>
+# include <cmpad/speed_clock.hpp>
 # include <cmpad/fun_speed.hpp>
+# include <cmpad/fun_compare.hpp>
 # include <cmpad/csv_speed.hpp>
+# include <cmpad/csv_latency.hpp>
+# include <cmpad/csv_append.hpp>
+# include <cmpad/results_store.hpp>
+# include <cmpad/break_even.hpp>
+# include <cmpad/bench_env.hpp>
+# include <cmpad/static_fun.hpp>
+# include <cmpad/cold_start.hpp>
+# include <cmpad/csv_cold_start.hpp>
+# include <cmpad/jit_lib.hpp>
+# include <cmpad/trace_event.hpp>
+# include <cmpad/sample_profiler.hpp>
+# include <cmpad/count_scalar.hpp>
 //
 // cmpad algorithms
 #
@@ -68,29 +87,158 @@ Source Code
 # define CMPAD_PACKAGE_TEST(package) \
    if( algorithm == "det_by_minor" ) \
    {  cmpad::package::gradient<cmpad::det_by_minor> grad_det; \
-      double rate = cmpad::fun_speed(grad_det, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
+      cmpad::speed_result_t speed = \
+         cmpad::fun_speed(grad_det, option, min_time, speed_option); \
+      record_speed(speed); \
       case_found = true; \
    } \
    else if( algorithm == "an_ode" ) \
    {  cmpad::package::gradient<cmpad::an_ode> grad_ode; \
-      double rate = cmpad::fun_speed(grad_ode, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
+      cmpad::speed_result_t speed = \
+         cmpad::fun_speed(grad_ode, option, min_time, speed_option); \
+      record_speed(speed); \
       case_found = true; \
    } \
    else if( algorithm == "llsq_obj" ) \
    {  cmpad::package::gradient<cmpad::llsq_obj> grad_llsq; \
-      double rate = cmpad::fun_speed(grad_llsq, option, min_time); \
-      cmpad::csv_speed( \
-         file_name, rate, min_time, #package , algorithm, special, option \
-      ); \
+      cmpad::speed_result_t speed = \
+         cmpad::fun_speed(grad_llsq, option, min_time, speed_option); \
+      record_speed(speed); \
       case_found = true; \
    }
 
+// CMPAD_NEW_GRADIENT
+# define CMPAD_NEW_GRADIENT(package) \
+   if( algorithm == "det_by_minor" ) \
+      return std::make_unique< \
+         cmpad::package::gradient<cmpad::det_by_minor> \
+      >(); \
+   if( algorithm == "an_ode" ) \
+      return std::make_unique< \
+         cmpad::package::gradient<cmpad::an_ode> \
+      >(); \
+   if( algorithm == "llsq_obj" ) \
+      return std::make_unique< \
+         cmpad::package::gradient<cmpad::llsq_obj> \
+      >();
+
+// fun_obj_t
+typedef cmpad::fun_obj< cmpad::vector<double> > fun_obj_t;
+
+// new_fun_obj
+// function object used for package and algorithm
+// (a null pointer if this case is not available).
+std::unique_ptr<fun_obj_t> new_fun_obj(
+   const std::string& package, const std::string& algorithm
+)
+{  if( package == "none" )
+   {  if( algorithm == "det_by_minor" )
+         return std::make_unique<
+            cmpad::det_by_minor< cmpad::vector<double> >
+         >();
+      if( algorithm == "an_ode" )
+         return std::make_unique< cmpad::an_ode< cmpad::vector<double> > >();
+      if( algorithm == "llsq_obj" )
+         return std::make_unique<
+            cmpad::llsq_obj< cmpad::vector<double> >
+         >();
+   }
+# if CMPAD_HAS_ADEPT
+   else if( package == "adept" )
+   {  CMPAD_NEW_GRADIENT(adept) }
+# endif
+# if CMPAD_HAS_ADOLC
+   else if( package == "adolc" )
+   {  CMPAD_NEW_GRADIENT(adolc) }
+# endif
+# if CMPAD_HAS_AUTODIFF
+   else if( package == "autodiff" )
+   {  CMPAD_NEW_GRADIENT(autodiff) }
+# endif
+# if CMPAD_HAS_CODI
+   else if( package == "codi" )
+   {  CMPAD_NEW_GRADIENT(codi) }
+# endif
+# if CMPAD_HAS_CPPAD
+   else if( package == "cppad" )
+   {  CMPAD_NEW_GRADIENT(cppad) }
+# endif
+# if CMPAD_HAS_CPPAD_JIT
+   else if( package == "cppad_jit" )
+   {  CMPAD_NEW_GRADIENT(cppad_jit) }
+# endif
+# if CMPAD_HAS_CPPADCG
+   else if( package == "cppadcg" )
+   {  CMPAD_NEW_GRADIENT(cppadcg) }
+# endif
+# if CMPAD_HAS_SACADO
+   else if( package == "sacado" )
+   {  CMPAD_NEW_GRADIENT(sacado) }
+# endif
+   return std::unique_ptr<fun_obj_t>();
+}
+
+// speed_none
+// speed for the package none using the virtual function calls,
+// with static_ratio set using a static dispatch version of the same object.
+template <class Algo> cmpad::speed_result_t speed_none(
+   const cmpad::option_t&       option       ,
+   double                       min_time     ,
+   const cmpad::speed_option_t& speed_option )
+{  //
+   // speed
+   // calls through a fun_obj_t reference use the virtual function table
+   Algo       algo;
+   fun_obj_t& fun_virtual = algo;
+   cmpad::speed_result_t speed =
+      cmpad::fun_speed(fun_virtual, option, min_time, speed_option);
+   //
+   // static_speed
+   cmpad::speed_option_t static_option = speed_option;
+   static_option.perf_counter = false;
+   static_option.profile      = false;
+   static_option.latency      = false;
+   cmpad::static_fun<Algo> fun_static;
+   cmpad::speed_result_t static_speed =
+      cmpad::fun_speed(fun_static, option, min_time, static_option);
+   //
+   // speed.static_ratio
+   speed.static_ratio = static_speed.rate / speed.rate;
+   return speed;
+}
+
+// function_speed
+// speed for the algorithm without any derivatives; i.e., the package none.
+cmpad::speed_result_t function_speed(
+   const std::string&           algorithm    ,
+   const cmpad::option_t&       option       ,
+   double                       min_time     ,
+   const cmpad::speed_option_t& speed_option )
+{  if( algorithm == "det_by_minor" )
+   {  cmpad::det_by_minor< cmpad::vector<double> > det;
+      return cmpad::fun_speed(det, option, min_time, speed_option);
+   }
+   if( algorithm == "an_ode" )
+   {  cmpad::an_ode< cmpad::vector<double> > ode;
+      return cmpad::fun_speed(ode, option, min_time, speed_option);
+   }
+   assert( algorithm == "llsq_obj" );
+   cmpad::llsq_obj< cmpad::vector<double> > llsq;
+   return cmpad::fun_speed(llsq, option, min_time, speed_option);
+}
+
+// algorithm_flop
+// number of floating point operations for one computation of the algorithm
+double algorithm_flop(
+   const std::string&           algorithm    ,
+   const cmpad::option_t&       option       )
+{  if( algorithm == "det_by_minor" )
+      return double( cmpad::op_count<cmpad::det_by_minor>(option).n_flop() );
+   if( algorithm == "an_ode" )
+      return double( cmpad::op_count<cmpad::an_ode>(option).n_flop() );
+   assert( algorithm == "llsq_obj" );
+   return double( cmpad::op_count<cmpad::llsq_obj>(option).n_flop() );
+}
 
 // get_package_available
 cmpad::vector<std::string> get_package_available(void)
@@ -125,9 +273,39 @@ cmpad::vector<std::string> get_package_available(void)
 
 int main(int argc, char* argv[])
 {  //
+   // t_parse
+   cmpad::trace_event::time_point t_parse = std::chrono::steady_clock::now();
+   //
    // arguments
    arguments_t arguments = parse_args(argc, argv);
    //
+   // trace_file
+   // the span for parse_args is recorded after we know if tracing is enabled
+   std::string trace_file = arguments.trace_file;
+   cmpad::trace_event::enable( trace_file != "" );
+   cmpad::trace_event::complete(
+      "parse_args", "run_cmpad", t_parse, std::chrono::steady_clock::now()
+   );
+   //
+   // fsync
+   cmpad::csv_append::enable_fsync( arguments.fsync );
+   //
+   // store_dir
+   cmpad::results_store::set_speed_dir( arguments.store_dir );
+   //
+   // write_trace
+   auto write_trace = [&](void)
+   {  if( trace_file == "" )
+         return true;
+      cmpad::trace_event::enable(false);
+      if( ! cmpad::trace_event::write(trace_file) )
+      {  std::cerr << "run_cmpad Error: cannot write trace_file = "
+            << trace_file << "\n";
+         return false;
+      }
+      return true;
+   };
+   //
    // package_vec
    cmpad::vector<std::string> package_vec = get_package_available();
    //
@@ -194,13 +372,71 @@ int main(int argc, char* argv[])
    //
    // min_time
    double min_time = arguments.min_time;
-   if( min_time <= 0.0 || 1.0 < min_time )
+   if( min_time <= 0.0 )
    {  std::cerr << "run_cmpad Error: min_time = ";
-      std::cerr << min_time <<
-         " is less than or equal zero or greater than one.\n";
+      std::cerr << min_time << " is less than or equal zero.\n";
+      return 1;
+   }
+   //
+   // n_sample
+   size_t n_sample = arguments.n_sample;
+   if( n_sample == 0 )
+   {  std::cerr << "run_cmpad Error: n_sample is zero\n";
+      return 1;
+   }
+   //
+   // n_pool
+   size_t n_pool = arguments.n_pool;
+   if( n_pool == 0 )
+   {  std::cerr << "run_cmpad Error: n_pool is zero\n";
       return 1;
    }
    //
+   // speed_option
+   cmpad::speed_option_t speed_option;
+   speed_option.n_sample = n_sample;
+   speed_option.n_warmup = arguments.n_warmup;
+   speed_option.n_pool   = n_pool;
+   //
+   // speed_option.clock
+   speed_option.clock = arguments.clock;
+   if( ! cmpad::speed_clock::available( speed_option.clock ) )
+   {  std::cerr << "run_cmpad Error: ";
+      std::cerr << "clock = " << speed_option.clock << " is not available\n";
+      return 1;
+   }
+   //
+   // speed_option.rel_error, speed_option.max_time
+   speed_option.rel_error = arguments.rel_error;
+   speed_option.max_time  = arguments.max_time;
+   if( speed_option.rel_error < 0.0 )
+   {  std::cerr << "run_cmpad Error: rel_error is less than zero\n";
+      return 1;
+   }
+   if( ! ( 0.0 < speed_option.max_time ) )
+   {  std::cerr << "run_cmpad Error: max_time is not greater than zero\n";
+      return 1;
+   }
+   //
+   // speed_option.flush_cache
+   speed_option.flush_cache = arguments.flush_cache;
+   //
+   // speed_option.profile
+   speed_option.profile = arguments.profile;
+   //
+   // perf_map
+   cmpad::jit_lib::enable_perf_map( arguments.perf_map );
+   //
+   // speed_option.perf_counter
+   speed_option.perf_counter = arguments.perf_counter;
+   if( speed_option.perf_counter )
+   {  cmpad::perf_counter counter;
+      if( counter.open() == 0 )
+      {  std::cerr << "run_cmpad Warning: cannot count hardware events; "
+            "see /proc/sys/kernel/perf_event_paranoid\n";
+      }
+   }
+   //
    // special
    // The only special case (so far) is for package = cppad and algo = llsq_obj.
    bool special = false;
@@ -211,33 +447,227 @@ int main(int argc, char* argv[])
    option.n_other     = n_other;
    option.time_setup = time_setup;
    //
+   // peak_gflops
+   double peak_gflops = arguments.peak_gflops;
+   if( peak_gflops < 0.0 )
+   {  std::cerr << "run_cmpad Error: peak_gflops is less than zero\n";
+      return 1;
+   }
+   //
+   // latency_file
+   std::string latency_file = arguments.latency_file;
+   speed_option.latency     = latency_file != "";
+   //
+   // cold_file
+   // The copy of this program started by cold_start_exec only measures the
+   // time to the first result; see cold_start_child.
+   std::string cold_file = arguments.cold_file;
+   if( cold_file != "" && cmpad::cold_start_child() )
+   {  std::unique_ptr<fun_obj_t> test_obj = new_fun_obj(package, algorithm);
+      std::unique_ptr<fun_obj_t> algo_obj = new_fun_obj("none", algorithm);
+      bool is_gradient = package != "none";
+      cmpad::cold_start_t cold =
+         cmpad::cold_start(*test_obj, *algo_obj, is_gradient, option);
+      cmpad::csv_cold_start(
+         cold_file, cold, package, algorithm, special, option
+      );
+      if( ! cold.correct )
+      {  std::cerr << "run_cmpad Error: the first result for package = "
+            << package << " is not correct\n";
+         return 1;
+      }
+      return 0;
+   }
+   if( cold_file != "" )
+   {  cmpad::trace_event span("cold_start", "run_cmpad");
+      if( cmpad::cold_start_exec(argv) != 0 )
+      {  std::cerr << "run_cmpad Error: cold start measurement failed\n";
+         return 1;
+      }
+   }
+   //
+   // env
+   // pin to a core and check for noisy conditions before any timing
+   int cpu = arguments.cpu;
+   if( 0 <= cpu && ! cmpad::pin_cpu(cpu) )
+   {  std::cerr << "run_cmpad Error: cannot pin to cpu = " << cpu << "\n";
+      return 1;
+   }
+   cmpad::trace_event env_span("bench_env", "run_cmpad");
+   cmpad::bench_env_t env     = cmpad::bench_env(cpu);
+   std::string        warning = cmpad::bench_warning(env);
+   env_span.stop();
+   if( warning != "" )
+   {  if( arguments.refuse_noisy )
+      {  std::cerr << "run_cmpad Error: noisy environment:\n" << warning;
+         return 1;
+      }
+      std::cerr << "run_cmpad Warning: noisy environment:\n" << warning;
+   }
+   //
+   // n_flop
+   double n_flop = algorithm_flop(algorithm, option);
+   //
+   // set_flop
+   auto set_flop = [&](cmpad::speed_result_t& speed)
+   {  speed.n_flop = n_flop;
+      speed.gflops = n_flop * speed.rate * 1e-9;
+      if( 0.0 < peak_gflops )
+         speed.efficiency = speed.gflops / peak_gflops;
+   };
+   //
+   // compare_vec
+   cmpad::vector<std::string> compare_vec;
+   if( arguments.compare != "" )
+   {  std::stringstream ss( arguments.compare );
+      std::string        name;
+      while( std::getline(ss, name, ',') )
+      {  itr = std::find(package_vec.begin(), package_vec.end(), name);
+         if( itr == package_vec.end() )
+         {  std::cerr << "run_cmpad Error: ";
+            std::cerr << "compare package = " << name << " is not available\n";
+            return 1;
+         }
+         compare_vec.push_back(name);
+      }
+   }
+   //
+   // interleaved comparison
+   if( compare_vec.size() > 0 )
+   {  if( speed_option.profile )
+      {  std::cerr << "run_cmpad Error: "
+            "profile cannot be used with compare\n";
+         return 1;
+      }
+      //
+      // fun_ptr, fun_vec
+      cmpad::vector< std::unique_ptr<fun_obj_t> > fun_ptr;
+      cmpad::vector<fun_obj_t*>                   fun_vec;
+      for(size_t k = 0; k < compare_vec.size(); ++k)
+      {  fun_ptr.push_back( new_fun_obj(compare_vec[k], algorithm) );
+         fun_vec.push_back( fun_ptr[k].get() );
+      }
+      //
+      // speed_vec
+      cmpad::vector<cmpad::speed_result_t> speed_vec =
+         cmpad::fun_compare(fun_vec, option, min_time, speed_option);
+      //
+      // file_name
+      for(size_t k = 0; k < compare_vec.size(); ++k)
+      {  speed_vec[k].ratio_base = compare_vec[0];
+         speed_vec[k].env        = env;
+         set_flop( speed_vec[k] );
+         cmpad::csv_speed(
+            file_name, speed_vec[k], min_time,
+            compare_vec[k], algorithm, special, option
+         );
+      }
+      return write_trace() ? 0 : 1;
+   }
+   //
+   // base_speed, base_found
+   // cppad result used to compute break_even for other packages
+   cmpad::speed_result_t base_speed;
+   bool                  base_found = false;
+# if CMPAD_HAS_CPPAD
+   if( package != "none" && package != "cppad" && ! time_setup )
+   {  cmpad::trace_event span("base_speed", "run_cmpad");
+      cmpad::speed_option_t base_option = speed_option;
+      base_option.perf_counter = false;
+      base_option.profile      = false;
+      base_option.latency      = false;
+      if( algorithm == "det_by_minor" )
+      {  cmpad::cppad::gradient<cmpad::det_by_minor> grad_det;
+         base_speed =
+            cmpad::fun_speed(grad_det, option, min_time, base_option);
+      }
+      else if( algorithm == "an_ode" )
+      {  cmpad::cppad::gradient<cmpad::an_ode> grad_ode;
+         base_speed =
+            cmpad::fun_speed(grad_ode, option, min_time, base_option);
+      }
+      else
+      {  assert( algorithm == "llsq_obj" );
+         cmpad::cppad::gradient<cmpad::llsq_obj> grad_llsq;
+         base_speed =
+            cmpad::fun_speed(grad_llsq, option, min_time, base_option);
+      }
+      base_found = true;
+   }
+# endif
+   //
+   // fun_speed_none
+   // result for the function, used to compute grad_ratio for other packages
+   cmpad::speed_result_t fun_speed_none;
+   if( package != "none" )
+   {  cmpad::trace_event span("function_speed", "run_cmpad");
+      cmpad::speed_option_t fun_option = speed_option;
+      fun_option.perf_counter = false;
+      fun_option.profile      = false;
+      fun_option.latency      = false;
+      fun_speed_none = function_speed(algorithm, option, min_time, fun_option);
+   }
+   //
+   // record_speed
+   auto record_speed = [&](cmpad::speed_result_t& speed)
+   {  cmpad::trace_event span("record_speed", "run_cmpad");
+      speed.env = env;
+      if( base_found )
+         speed.break_even = cmpad::break_even(speed, base_speed);
+      if( package != "none" )
+         speed.grad_ratio = fun_speed_none.rate / speed.rate;
+      set_flop(speed);
+      cmpad::csv_speed(
+         file_name, speed, min_time, package, algorithm, special, option
+      );
+      if( speed_option.latency )
+      {  cmpad::csv_latency(
+            latency_file, speed.latency, package, algorithm, special, option
+         );
+      }
+      if( speed_option.profile )
+      {  std::cout << "profile: package = " << package
+            << ", algorithm = " << algorithm;
+         if( special )
+            std::cout << ", special";
+         std::cout << "\n";
+         if( speed.profile.size() == 0 )
+            std::cout << "no call stacks were recorded\n";
+         else
+         {  cmpad::sample_profiler::print(
+               std::cout, speed.profile, speed.n_profile, 20
+            );
+         }
+      }
+   };
+   //
    // case_found
    bool case_found = false;
    //
    // file_name, case_found
    if( package == "none" )
    {  if( algorithm == "det_by_minor" )
-      {  cmpad::det_by_minor< cmpad::vector<double> > det;
-         double rate = cmpad::fun_speed(det, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
+      {  cmpad::speed_result_t speed =
+            speed_none< cmpad::det_by_minor< cmpad::vector<double> > >(
+               option, min_time, speed_option
          );
+         record_speed(speed);
          case_found = true;
       }
       else if( algorithm == "an_ode" )
-      {  cmpad::an_ode< cmpad::vector<double> > det;
-         double rate = cmpad::fun_speed(det, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
+      {  cmpad::speed_result_t speed =
+            speed_none< cmpad::an_ode< cmpad::vector<double> > >(
+               option, min_time, speed_option
          );
+         record_speed(speed);
          case_found = true;
       }
       else if( algorithm == "llsq_obj" )
-      {  cmpad::llsq_obj< cmpad::vector<double> > llsq;
-         double rate = cmpad::fun_speed(llsq, option, min_time);
-         cmpad::csv_speed(
-            file_name, rate, min_time, "none", algorithm, special, option
+      {  cmpad::speed_result_t speed =
+            speed_none< cmpad::llsq_obj< cmpad::vector<double> > >(
+               option, min_time, speed_option
          );
+         record_speed(speed);
          case_found = true;
       }
    }
@@ -271,11 +701,11 @@ int main(int argc, char* argv[])
       //
       if( algorithm == "llsq_obj" )
       {  cmpad::cppad::special::gradient<cmpad::llsq_obj> special_grad_llsq;
-         double rate = cmpad::fun_speed(special_grad_llsq, option, min_time);
-         special = true;
-         cmpad::csv_speed(
-            file_name, rate, min_time, "cppad" , algorithm, special, option
+         cmpad::speed_result_t speed = cmpad::fun_speed(
+            special_grad_llsq, option, min_time, speed_option
          );
+         special = true;
+         record_speed(speed);
          special = false;
       }
    }
@@ -300,7 +730,7 @@ int main(int argc, char* argv[])
 # endif
    //
    if( case_found )
-      return  0;
+      return write_trace() ? 0 : 1;
    //
    std::cerr << "cmpad: BUG\n";
    return 1;
@@ -6,6 +6,7 @@
 # define TEST_CSV_FIXTURE_HPP
 
 # include <filesystem>
+# include <sstream>
 # include <cmpad/csv_read.hpp>
 # include "to_string.hpp"
 
@@ -17,6 +18,9 @@ public:
    // min_time_
    const double min_time_;
    //
+   // n_sample_
+   const size_t n_sample_;
+   //
    // debug_
    const std::string debug_;
    //
@@ -36,9 +40,10 @@ public:
    std::string csv_file_path_;
    //
    // ctor
-   // min_time_, debug_
+   // min_time_, n_sample_, debug_
    csv_fixture(void)
    : min_time_(0.1)
+   , n_sample_(5)
 # ifdef NDEBUG
    , debug_("false")
 # else
@@ -100,7 +105,37 @@ public:
          "compiler",
          "debug",
          "language",
-         "special"
+         "special",
+         "n_warmup",
+         "n_sample",
+         "n_pool",
+         "n_outlier",
+         "time_median",
+         "time_mad",
+         "time_min",
+         "time_lower",
+         "time_upper",
+         "time_init",
+         "break_even",
+         "n_op",
+         "n_var",
+         "tape_bytes",
+         "work_bytes",
+         "alloc_setup",
+         "byte_setup",
+         "alloc_eval",
+         "byte_eval",
+         "max_rss",
+         "clock",
+         "time_overhead",
+         "rel_error",
+         "ctx_switch",
+         "page_fault",
+         "cpu",
+         "governor",
+         "turbo",
+         "load_avg",
+         "time_sample"
       };
       //
       // language
@@ -135,6 +170,26 @@ public:
          BOOST_CHECK( csv_table[i][8] == CMPAD_CXX_COMPILER );
          BOOST_CHECK( csv_table[1][9] == debug_ );
          BOOST_CHECK( csv_table[1][10] == language );
+         //
+         BOOST_CHECK( csv_table[i][13] == std::to_string(n_sample_) );
+         double time_median = std::atof( csv_table[i][16].c_str() );
+         double time_lower  = std::atof( csv_table[i][19].c_str() );
+         double time_upper  = std::atof( csv_table[i][20].c_str() );
+         BOOST_CHECK( 0.0 < time_lower );
+         BOOST_CHECK( time_lower <= time_median );
+         BOOST_CHECK( time_median <= time_upper );
+         double time_init   = std::atof( csv_table[i][21].c_str() );
+         BOOST_CHECK( 0.0 < time_init );
+         //
+         // time_sample
+         std::stringstream ss( csv_table[i][41] );
+         size_t            n_time = 0;
+         double            time;
+         while( ss >> time )
+         {  BOOST_CHECK( 0.0 < time );
+            ++n_time;
+         }
+         BOOST_CHECK( n_time == n_sample_ );
       }
    }
 };
@@ -31,10 +31,13 @@
       /* \
       csv_file_path_ */ \
       cmpad::algorithm_value< cmpad::vector<double> > fun; \
-      double rate    = cmpad::fun_speed(fun, option, min_time_); \
+      cmpad::speed_option_t speed_option; \
+      speed_option.n_sample = n_sample_; \
+      cmpad::speed_result_t speed = \
+         cmpad::fun_speed(fun, option, min_time_, speed_option); \
       bool   special = false; \
       cmpad::csv_speed( csv_file_path_,  \
-         rate, min_time_, package_, algorithm_, special, option \
+         speed, min_time_, package_, algorithm_, special, option \
       ); \
    } \
    check();
@@ -17,17 +17,41 @@
    BOOST_AUTO_TEST_SUITE_END()
 
 // BEGIN_SORT_THIS_LINE_PLUS_1
+CMPAD_TEST_EXAMPLE(alloc_count)
 CMPAD_TEST_EXAMPLE(an_ode)
+CMPAD_TEST_EXAMPLE(bench_env)
+CMPAD_TEST_EXAMPLE(break_even)
+CMPAD_TEST_EXAMPLE(cache_info)
+CMPAD_TEST_EXAMPLE(case_sample)
+CMPAD_TEST_EXAMPLE(cold_start)
+CMPAD_TEST_EXAMPLE(count_scalar)
+CMPAD_TEST_EXAMPLE(csv_append)
+CMPAD_TEST_EXAMPLE(csv_cold_start)
+CMPAD_TEST_EXAMPLE(csv_latency)
 CMPAD_TEST_EXAMPLE(csv_read)
+CMPAD_TEST_EXAMPLE(csv_scan)
 CMPAD_TEST_EXAMPLE(csv_speed)
 CMPAD_TEST_EXAMPLE(csv_write)
 CMPAD_TEST_EXAMPLE(det_by_minor)
 CMPAD_TEST_EXAMPLE(det_of_minor)
+CMPAD_TEST_EXAMPLE(fun_compare)
 CMPAD_TEST_EXAMPLE(fun_obj)
 CMPAD_TEST_EXAMPLE(fun_speed)
+CMPAD_TEST_EXAMPLE(jit_lib)
+CMPAD_TEST_EXAMPLE(latency_histogram)
 CMPAD_TEST_EXAMPLE(llsq_obj)
+CMPAD_TEST_EXAMPLE(mann_whitney)
 CMPAD_TEST_EXAMPLE(near_equal)
+CMPAD_TEST_EXAMPLE(perf_counter)
+CMPAD_TEST_EXAMPLE(phase_timer)
+CMPAD_TEST_EXAMPLE(results_query)
+CMPAD_TEST_EXAMPLE(results_store)
 CMPAD_TEST_EXAMPLE(runge_kutta)
+CMPAD_TEST_EXAMPLE(sample_profiler)
+CMPAD_TEST_EXAMPLE(speed_clock)
+CMPAD_TEST_EXAMPLE(speed_stat)
+CMPAD_TEST_EXAMPLE(static_fun)
+CMPAD_TEST_EXAMPLE(trace_event)
 CMPAD_TEST_EXAMPLE(uniform_01)
 // END_SORT_THIS_LINE_MINUS_1
 //
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_alloc_count.cpp}
+
+Example and Test of alloc_count
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_alloc_count.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <memory>
+# include <cmpad/alloc_count.hpp>
+
+bool xam_alloc_count(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // n_alloc_before, n_byte_before
+   size_t n_alloc_before = cmpad::alloc_count::n_alloc();
+   size_t n_byte_before  = cmpad::alloc_count::n_byte();
+   //
+   // ptr
+   // allocate an array of 100 doubles (and use it)
+   std::unique_ptr<double[]> ptr( new double[100] );
+   for(size_t i = 0; i < 100; ++i)
+      ptr[i] = double(i);
+   ok &= ptr[99] == 99.0;
+   //
+   // n_alloc, n_byte
+   size_t n_alloc = cmpad::alloc_count::n_alloc() - n_alloc_before;
+   size_t n_byte  = cmpad::alloc_count::n_byte()  - n_byte_before;
+   //
+   // ok
+   if( cmpad::alloc_count::enabled() )
+   {  ok &= n_alloc == 1;
+      ok &= n_byte  >= 100 * sizeof(double);
+   }
+   else
+   {  ok &= n_alloc == 0;
+      ok &= n_byte  == 0;
+   }
+   //
+   // ok
+   // max_rss is nan when getrusage is not available
+   double max_rss = cmpad::alloc_count::max_rss();
+   if( ! std::isnan(max_rss) )
+      ok &= 0.0 < max_rss;
+   //
+   return ok;
+}
+// END C++
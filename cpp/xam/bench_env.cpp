@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_bench_env.cpp}
+
+Example and Test of bench_env
+#############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_bench_env.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/bench_env.hpp>
+
+bool xam_bench_env(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   // there is no core with a negative index
+   ok &= ! cmpad::pin_cpu(-1);
+   //
+   // env
+   cmpad::bench_env_t env = cmpad::bench_env(-1);
+   ok &= env.cpu == -1;
+   ok &= env.turbo == "" || env.turbo == "on" || env.turbo == "off";
+   if( ! std::isnan(env.load_avg) )
+      ok &= 0.0 <= env.load_avg;
+   //
+   // ok
+   // a quiet environment does not generate a warning
+   cmpad::bench_env_t quiet;
+   quiet.governor = "performance";
+   quiet.turbo    = "off";
+   quiet.load_avg = 0.1;
+   ok &= cmpad::bench_warning(quiet) == "";
+   //
+   // ok
+   // the benchmark process itself does not make the environment noisy
+   quiet.load_avg = 1.2;
+   ok &= cmpad::bench_warning(quiet) == "";
+   //
+   // ok
+   // a noisy environment generates a warning for each condition
+   cmpad::bench_env_t noisy;
+   noisy.governor = "powersave";
+   noisy.turbo    = "on";
+   noisy.load_avg = 2.0;
+   std::string warning = cmpad::bench_warning(noisy);
+   ok &= warning.find("powersave") != std::string::npos;
+   ok &= warning.find("turbo")     != std::string::npos;
+   ok &= warning.find("load")      != std::string::npos;
+   //
+   // ok
+   // the counts do not decrease
+   double ctx_start, fault_start, ctx_end, fault_end;
+   cmpad::rusage_count(ctx_start, fault_start);
+   cmpad::rusage_count(ctx_end, fault_end);
+   if( ! std::isnan(ctx_start) )
+   {  ok &= ctx_start <= ctx_end;
+      ok &= fault_start <= fault_end;
+   }
+   //
+   return ok;
+}
+// END C++
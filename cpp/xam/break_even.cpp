@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_break_even.cpp}
+
+Example and Test of break_even
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_break_even.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/break_even.hpp>
+
+bool xam_break_even(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // base
+   // a function object with a fast setup
+   cmpad::speed_result_t base;
+   base.time_init   = 1e-3;
+   base.time_median = 1e-6;
+   //
+   // speed
+   // a function object that compiles code during its setup
+   cmpad::speed_result_t speed;
+   speed.time_init   = 1e-1;
+   speed.time_median = 1e-7;
+   //
+   // ok
+   // 1e-1 + n * 1e-7 = 1e-3 + n * 1e-6  implies n = 0.099 / 9e-7 = 110000
+   double n_star = cmpad::break_even(speed, base);
+   ok &= std::fabs( n_star - 110000.0 ) < 1e-6 * 110000.0;
+   //
+   // ok
+   // base never beats speed after n_star
+   ok &= std::isinf( cmpad::break_even(base, speed) );
+   //
+   // ok
+   // a function object always beats itself
+   ok &= cmpad::break_even(base, base) == 0.0;
+   //
+   // ok
+   // time_init has not been set
+   cmpad::speed_result_t empty;
+   empty.time_median = 1e-6;
+   ok &= std::isnan( cmpad::break_even(empty, base) );
+   //
+   return ok;
+}
+// END C++
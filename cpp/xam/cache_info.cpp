@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_cache_info.cpp}
+
+Example and Test of cache_info
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_cache_info.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <limits>
+# include <cmpad/cache_info.hpp>
+# include <cmpad/fun_speed.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+
+bool xam_cache_info(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // size, n_level
+   // the cache sizes are not available on some systems
+   const cmpad::vector<size_t>& size = cmpad::cache_size();
+   size_t n_level = size.size();
+   //
+   // ok
+   double nan = std::numeric_limits<double>::quiet_NaN();
+   ok &= cmpad::cache_level(nan) == 0;
+   if( n_level == 0 )
+      ok &= cmpad::cache_level(1.0) == 0;
+   else
+   {  // the caches get larger as the level increases
+      for(size_t level = 1; level < n_level; ++level)
+         ok &= size[level - 1] < size[level];
+      //
+      ok &= cmpad::cache_level(1.0) == 1;
+      ok &= cmpad::cache_level( double( size[0] ) ) == 1;
+      ok &= cmpad::cache_level( double( size[0] + 1 ) ) == 2;
+      double n_byte = 2.0 * double( size[n_level - 1] );
+      ok &= cmpad::cache_level(n_byte) == n_level + 1;
+   }
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg      = 9;
+   option.n_other    = 0;
+   option.time_setup = false;
+   //
+   // speed_option
+   cmpad::speed_option_t speed_option;
+   speed_option.n_sample    = 3;
+   speed_option.flush_cache = true;
+   //
+   // speed
+   // time det_by_minor with the caches flushed before each computation
+   double min_time = 0.05;
+   cmpad::det_by_minor< cmpad::vector<double> > det;
+   cmpad::speed_result_t speed =
+      cmpad::fun_speed(det, option, min_time, speed_option);
+   //
+   // ok
+   ok &= speed.flush_cache;
+   ok &= 0.0 < speed.rate;
+   ok &= speed.time_sample.size() == 3;
+   //
+   // ok
+   // det_by_minor is not a gradient so it does not have a tape
+   ok &= std::isnan( speed.cache_level );
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_case_sample.cpp}
+
+Example and Test of case_sample
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_case_sample.cpp}
+*/
+// BEGIN C++
+# include <cstdio>
+# include <cmpad/case_sample.hpp>
+# include <cmpad/csv_write.hpp>
+
+bool xam_case_sample(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // key_name
+   const cmpad::vector<std::string>& key_name = cmpad::case_key_name();
+   ok &= key_name.size() == 7;
+   ok &= key_name[5] == "special";
+   ok &= key_name[6] == "flush_cache";
+   //
+   // table
+   // the first two rows only differ in special,
+   // the third row is in the same case as the first row
+   // and the last row does not have a time_sample value
+   cmpad::vec_vec_str table = {
+      { "package", "algorithm", "n_arg", "special", "rate", "time_sample" },
+      { "cppad",   "llsq_obj",  "4",     "false",   "",     "1 2"         },
+      { "cppad",   "llsq_obj",  "4",     "true",    "",     "5 6 7"       },
+      { "cppad",   "llsq_obj",  "4",     "false",   "",     "3"           },
+      { "cppad",   "llsq_obj",  "9",     "false",   "4",    ""            }
+   };
+   //
+   // file_name
+   std::string file_name = "xam_case_sample.csv";
+   cmpad::csv_write(file_name, table);
+   //
+   // sample, order
+   cmpad::case_sample_t             sample;
+   cmpad::vector<cmpad::case_key_t> order;
+   std::string msg = cmpad::case_sample(file_name, sample, order);
+   std::remove( file_name.c_str() );
+   //
+   // ok
+   // n_other, time_setup, and flush_cache are not in the file
+   ok &= msg == "";
+   ok &= order.size() == 3;
+   ok &= sample.size() == 3;
+   if( ok )
+   {  cmpad::case_key_t normal  =
+         { "cppad", "llsq_obj", "4", "", "", "false", "" };
+      cmpad::case_key_t special =
+         { "cppad", "llsq_obj", "4", "", "", "true",  "" };
+      cmpad::case_key_t rate    =
+         { "cppad", "llsq_obj", "9", "", "", "false", "" };
+      ok &= order[0] == normal;
+      ok &= order[1] == special;
+      ok &= order[2] == rate;
+      ok &= sample[normal]  == cmpad::vector<double>{ 1.0, 2.0, 3.0 };
+      ok &= sample[special] == cmpad::vector<double>{ 5.0, 6.0, 7.0 };
+      ok &= sample[rate]    == cmpad::vector<double>{ 0.25 };
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_cold_start.cpp}
+
+Example and Test of cold_start
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_cold_start.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/cold_start.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/algo/an_ode.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+   // grad_det
+   // gradient of the determinant of a 2 by 2 matrix
+   // (the sign of the result is wrong when bad is true)
+   class grad_det : public cmpad::fun_obj< cmpad::vector<double> > {
+   private:
+      // bad_
+      const bool bad_;
+      //
+      // option_
+      cmpad::option_t option_;
+      //
+      // g_
+      cmpad::vector<double> g_;
+   public:
+      //
+      // scalar_type
+      typedef double scalar_type;
+      //
+      // constructor
+      grad_det(bool bad) : bad_(bad)
+      { }
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         g_.resize(4);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_;
+      }
+      // domain
+      size_t domain(void) const override
+      {  return 4;
+      }
+      // range
+      size_t range(void) const override
+      {  return 4;
+      }
+      // operator()
+      // det = x[0] * x[3] - x[1] * x[2]
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  double sign = bad_ ? -1.0 : 1.0;
+         g_[0] =   sign * x[3];
+         g_[1] = - sign * x[2];
+         g_[2] = - sign * x[1];
+         g_[3] =   sign * x[0];
+         return g_;
+      }
+   };
+
+   // grad_ode
+   // gradient of the last component of an_ode when n_arg is four
+   // yf[3] = x[0] * x[1] * x[2] * x[3] * tf^4 / 4!  where tf = 2
+   // (the Runge-Kutta method is exact for this case)
+   class grad_ode : public cmpad::fun_obj< cmpad::vector<double> > {
+   private:
+      // option_
+      cmpad::option_t option_;
+      //
+      // g_
+      cmpad::vector<double> g_;
+   public:
+      //
+      // scalar_type
+      typedef double scalar_type;
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  option_ = option;
+         g_.resize(4);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return option_;
+      }
+      // domain
+      size_t domain(void) const override
+      {  return 4;
+      }
+      // range
+      size_t range(void) const override
+      {  return 4;
+      }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  double scale = 16.0 / 24.0;
+         for(size_t j = 0; j < 4; ++j)
+         {  g_[j] = scale;
+            for(size_t k = 0; k < 4; ++k)
+               if( k != j )
+                  g_[j] *= x[k];
+         }
+         return g_;
+      }
+   };
+
+} // END_EMPTY_NAMESPACE
+
+bool xam_cold_start(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   // this program was not started by cold_start_exec
+   ok &= ! cmpad::cold_start_child();
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg      = 4;
+   option.n_other    = 0;
+   option.time_setup = false;
+   //
+   // ok
+   // a function object that is the same as the algorithm
+   {  cmpad::det_by_minor< cmpad::vector<double> > det;
+      cmpad::det_by_minor< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(det, algo, false, option);
+      ok &= cold.correct;
+      ok &= std::isnan( cold.time_load );
+      ok &= 0.0 <= cold.time_setup;
+      ok &= 0.0 <= cold.time_eval;
+      ok &= cold.time_setup + cold.time_eval <= cold.time_total;
+   }
+   //
+   // ok
+   // a gradient of the algorithm
+   {  grad_det grad(false);
+      cmpad::det_by_minor< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(grad, algo, true, option);
+      ok &= cold.correct;
+   }
+   //
+   // ok
+   // a gradient that is not correct
+   {  grad_det grad(true);
+      cmpad::det_by_minor< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(grad, algo, true, option);
+      ok &= ! cold.correct;
+   }
+   //
+   // option
+   // an_ode has the same domain and range as its gradient
+   option.n_other = 3;
+   //
+   // ok
+   // an_ode is the same as the algorithm
+   {  cmpad::an_ode< cmpad::vector<double> > ode;
+      cmpad::an_ode< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(ode, algo, false, option);
+      ok &= cold.correct;
+   }
+   //
+   // ok
+   // a gradient of an_ode
+   {  grad_ode grad;
+      cmpad::an_ode< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(grad, algo, true, option);
+      ok &= cold.correct;
+   }
+   //
+   // ok
+   // an_ode is not a gradient of an_ode
+   {  cmpad::an_ode< cmpad::vector<double> > ode;
+      cmpad::an_ode< cmpad::vector<double> > algo;
+      cmpad::cold_start_t cold = cmpad::cold_start(ode, algo, true, option);
+      ok &= ! cold.correct;
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_count_scalar.cpp}
+
+Example and Test of count_scalar
+################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_count_scalar.cpp}
+*/
+// BEGIN C++
+# include <cmpad/count_scalar.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/algo/llsq_obj.hpp>
+
+bool xam_count_scalar(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // x, y, z
+   cmpad::count_scalar x(3.0), y(2.0), z;
+   //
+   // count
+   cmpad::count_scalar::clear();
+   z  = x * y + x / y - 1.0;
+   z += 2.0 * x;
+   z  = - z;
+   ok &= z.value() == - ( 3.0 * 2.0 + 3.0 / 2.0 - 1.0 + 2.0 * 3.0 );
+   ok &= x < y || x == 3.0;
+   cmpad::op_count_t count = cmpad::count_scalar::count();
+   //
+   // ok
+   ok &= count.add     == 2;
+   ok &= count.sub     == 1;
+   ok &= count.mul     == 2;
+   ok &= count.div     == 1;
+   ok &= count.neg     == 1;
+   ok &= count.compare == 2;
+   ok &= count.n_flop() == 7;
+   //
+   // option
+   cmpad::option_t option;
+   option.time_setup = false;
+   //
+   // ok
+   // the determinant of a 3 by 3 matrix by minors has three terms;
+   // each is an element times the determinant of a 2 by 2 minor
+   option.n_arg   = 9;
+   option.n_other = 0;
+   count = cmpad::op_count<cmpad::det_by_minor>(option);
+   ok &= count.mul == 9;
+   ok &= count.add == 5;
+   ok &= count.sub == 4;
+   ok &= count.div == 0;
+   //
+   // ok
+   // llsq_obj with n = n_arg and m = n_other
+   size_t n       = 4;
+   size_t m       = 5;
+   option.n_arg   = n;
+   option.n_other = m;
+   count = cmpad::op_count<cmpad::llsq_obj>(option);
+   ok &= count.mul == m * (2 * n + 1) + 1;
+   ok &= count.add == m * (n + 1);
+   ok &= count.sub == m;
+   ok &= count.div == 0;
+   //
+   // ok
+   // op_count clears the counts
+   ok &= cmpad::count_scalar::count().n_flop() == 0;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_csv_append.cpp}
+
+Example and Test of csv_append
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_csv_append.cpp}
+*/
+// BEGIN C++
+# include <cerrno>
+# include <cstdio>
+# include <fstream>
+# include <sstream>
+# include <cmpad/csv_append.hpp>
+# if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h>
+# include <sys/wait.h>
+# endif
+
+namespace {
+   std::string get_file(const std::string& file_name)
+   {  std::ifstream     ifs(file_name);
+      std::stringstream ss;
+      ss << ifs.rdbuf();
+      return ss.str();
+   }
+}
+
+bool xam_csv_append(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // file_name
+   std::string file_name = "xam_csv_append.csv";
+   std::remove( file_name.c_str() );
+   //
+   // ok
+   // an empty file gets the header line
+   cmpad::vector<std::string> col_name = { "A", "B" };
+   cmpad::vec_vec_str         row_vec  = { {"a1", "b1"} };
+   ok &= cmpad::csv_append::rows(file_name, col_name, row_vec, false);
+   ok &= get_file(file_name) == "A,B\na1,b1\n";
+   //
+   // ok
+   // rows are appended in the order of the header line
+   col_name = { "B", "A" };
+   row_vec  = { {"b2", "a2"}, {"b3", "a3"} };
+   ok &= cmpad::csv_append::rows(file_name, col_name, row_vec, true);
+   ok &= get_file(file_name) == "A,B\na1,b1\na2,b2\na3,b3\n";
+   //
+   // ok
+   // the header line does not match and extend is false
+   col_name = { "A", "C" };
+   row_vec  = { {"a4", "c4"} };
+   ok &= ! cmpad::csv_append::rows(file_name, col_name, row_vec, false);
+   ok &= errno == 0;
+   ok &= get_file(file_name) == "A,B\na1,b1\na2,b2\na3,b3\n";
+   //
+   // ok
+   // the column C is added to the header line and the previous rows
+   ok &= cmpad::csv_append::rows(file_name, col_name, row_vec, true);
+   ok &= get_file(file_name) ==
+      "A,B,C\na1,b1,\na2,b2,\na3,b3,\na4,,c4\n";
+   std::remove( file_name.c_str() );
+# if defined(__unix__) || defined(__APPLE__)
+   //
+   // ok
+   // several processes append to the same file at the same time
+   size_t n_child = 4;
+   size_t n_row   = 50;
+   col_name = { "child", "row" };
+   cmpad::vector<pid_t> pid(n_child);
+   for(size_t i = 0; i < n_child; ++i)
+   {  pid[i] = fork();
+      if( pid[i] == 0 )
+      {  bool child_ok = true;
+         for(size_t j = 0; j < n_row; ++j)
+         {  row_vec = { { std::to_string(i), std::to_string(j) } };
+            child_ok &= cmpad::csv_append::rows(
+               file_name, col_name, row_vec, false
+            );
+         }
+         _exit( child_ok ? 0 : 1 );
+      }
+      ok &= pid[i] > 0;
+   }
+   for(size_t i = 0; i < n_child; ++i)
+   {  int status = 1;
+      if( pid[i] > 0 )
+         waitpid(pid[i], &status, 0);
+      ok &= WIFEXITED(status) && WEXITSTATUS(status) == 0;
+   }
+   //
+   // ok
+   // every line is complete and there is one header line
+   std::istringstream lines( get_file(file_name) );
+   std::string        line;
+   size_t             n_line   = 0;
+   size_t             n_header = 0;
+   while( std::getline(lines, line) )
+   {  ++n_line;
+      if( line == "child,row" )
+         ++n_header;
+      else
+         ok &= line.find(',') != std::string::npos;
+   }
+   ok &= n_header == 1;
+   ok &= n_line == 1 + n_child * n_row;
+   std::remove( file_name.c_str() );
+# endif
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_csv_cold_start.cpp}
+
+Example and Test of csv_cold_start
+##################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_csv_cold_start.cpp}
+*/
+// BEGIN C++
+# include <filesystem>
+# include <cmpad/configure.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/csv_read.hpp>
+# include <cmpad/csv_cold_start.hpp>
+
+bool xam_csv_cold_start(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // filesystem
+   namespace filesystem =  std::filesystem;
+   //
+   // file_name
+   filesystem::path file_path(CMPAD_PROJECT_DIR);
+   file_path /= "build";
+   file_path /= "csv_cold_start.csv";
+   std::string file_name = file_path.c_str();
+   if( filesystem::exists( file_path )  )
+      std::remove( file_name.c_str() );
+   //
+   // package, algorithm, special
+   std::string package   = "none";
+   std::string algorithm = "det_by_minor";
+   bool        special   = false;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg       = 9;
+   option.n_other     = 0;
+   option.time_setup = false;
+   //
+   // cold
+   cmpad::det_by_minor< cmpad::vector<double> > det;
+   cmpad::det_by_minor< cmpad::vector<double> > algo;
+   cmpad::cold_start_t cold = cmpad::cold_start(det, algo, false, option);
+   //
+   // file_name
+   // add two rows to the file
+   for(size_t i = 0; i < 2; ++i)
+      cmpad::csv_cold_start(file_name, cold, package, algorithm, special, option);
+   //
+   // ok
+   cmpad::vec_vec_str csv_table = cmpad::csv_read(file_name);
+   ok &= csv_table.size() == 3;
+   ok &= csv_table[0][0]  == "package";
+   ok &= csv_table[0][6]  == "cold_load";
+   ok &= csv_table[0][10] == "correct";
+   for(size_t i = 1; i < 3; ++i)
+   {  ok &= csv_table[i].size() == 11;
+      ok &= csv_table[i][0]  == package;
+      ok &= csv_table[i][1]  == algorithm;
+      ok &= csv_table[i][2]  == "9";
+      ok &= csv_table[i][4]  == "false";
+      //
+      // this program was not started by cold_start_exec
+      ok &= csv_table[i][6]  == "";
+      for(size_t j = 7; j < 10; ++j)
+         ok &= std::atof( csv_table[i][j].c_str() ) >= 0.0;
+      ok &= csv_table[i][10] == "true";
+   }
+   //
+   return ok;
+}
+// END C++
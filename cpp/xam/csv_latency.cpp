@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_csv_latency.cpp}
+
+Example and Test of csv_latency
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_csv_latency.cpp}
+*/
+// BEGIN C++
+# include <filesystem>
+# include <cmpad/configure.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/fun_speed.hpp>
+# include <cmpad/csv_read.hpp>
+# include <cmpad/csv_speed.hpp>
+# include <cmpad/csv_latency.hpp>
+
+bool xam_csv_latency(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // filesystem
+   namespace filesystem =  std::filesystem;
+   //
+   // min_time
+   double min_time = 0.1;
+   //
+   // file_name, latency_file
+   filesystem::path file_path(CMPAD_PROJECT_DIR);
+   file_path /= "build";
+   filesystem::path latency_path = file_path;
+   file_path    /= "csv_latency_speed.csv";
+   latency_path /= "csv_latency.csv";
+   std::string file_name    = file_path.c_str();
+   std::string latency_file = latency_path.c_str();
+   if( filesystem::exists( file_path )  )
+      std::remove( file_name.c_str() );
+   if( filesystem::exists( latency_path )  )
+      std::remove( latency_file.c_str() );
+   //
+   // package, algorithm, special
+   std::string package   = "none";
+   std::string algorithm = "det_by_minor";
+   bool        special   = false;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg       = 4;
+   option.n_other     = 0;
+   option.time_setup = false;
+   //
+   // speed_option
+   cmpad::speed_option_t speed_option;
+   speed_option.n_sample = 3;
+   speed_option.latency  = true;
+   //
+   // det_double
+   cmpad::det_by_minor< cmpad::vector<double> > det_double;
+   //
+   // speed
+   cmpad::speed_result_t speed =
+      cmpad::fun_speed(det_double, option, min_time, speed_option);
+   ok &= speed.latency.n_call() > 0;
+   ok &= speed.latency.n_call() % speed_option.n_sample == 0;
+   //
+   // ok
+   // percentiles are increasing and bounded by the max
+   double p50  = speed.latency.percentile(50.0);
+   double p99  = speed.latency.percentile(99.0);
+   double max  = speed.latency.max();
+   ok &= 0.0 < p50 && p50 <= p99 && p99 <= max;
+   //
+   // csv_speed, csv_latency
+   cmpad::csv_speed(
+      file_name, speed, min_time, package, algorithm, special, option
+   );
+   cmpad::csv_latency(
+      latency_file, speed.latency, package, algorithm, special, option
+   );
+   //
+   // ok
+   // the latency columns are followed by the time_sample column
+   cmpad::vec_vec_str csv_table = cmpad::csv_read(file_name);
+   size_t n_col = csv_table[0].size();
+   ok &= csv_table.size() == 2;
+   ok &= csv_table[0][n_col - 6] == "latency_p50";
+   ok &= csv_table[0][n_col - 2] == "latency_max";
+   ok &= csv_table[0][n_col - 1] == "time_sample";
+   ok &= std::atof( csv_table[1][n_col - 2].c_str() ) > 0.0;
+   //
+   // ok
+   // the buckets in the latency file contain all the calls
+   csv_table = cmpad::csv_read(latency_file);
+   ok &= csv_table[0][0] == "package";
+   ok &= csv_table[0][8] == "count";
+   size_t n_call = 0;
+   for(size_t i = 1; i < csv_table.size(); ++i)
+   {  ok &= csv_table[i][0] == package;
+      ok &= csv_table[i][1] == algorithm;
+      ok &= std::atof( csv_table[i][6].c_str() ) <
+            std::atof( csv_table[i][7].c_str() );
+      n_call += size_t( std::atol( csv_table[i][8].c_str() ) );
+   }
+   ok &= n_call == speed.latency.n_call();
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_csv_scan.cpp}
+
+Example and Test of csv_scan
+############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_csv_scan.cpp}
+*/
+// BEGIN C++
+# include <cstdio>
+# include <cmpad/csv_scan.hpp>
+# include <cmpad/csv_read.hpp>
+# include <cmpad/csv_write.hpp>
+
+bool xam_csv_scan(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // text
+   // quoted fields, an empty field, "\r\n" line ending, no final newline
+   std::string_view text =
+      "name,value,note\r\n"
+      "\"a,b\",1,\n"
+      "\"say \"\"hi\"\"\",2,\"two\nlines\"\n"
+      "c,3,last"
+   ;
+   //
+   // table
+   cmpad::vec_vec_str table;
+   cmpad::csv_scan_text(text,
+      [&table](size_t index, const cmpad::vector<std::string_view>& row)
+      {  cmpad::vector<std::string> copy;
+         for(size_t j = 0; j < row.size(); ++j)
+            copy.push_back( std::string( row[j] ) );
+         table.push_back(copy);
+         return index + 1 == table.size();
+      }
+   );
+   //
+   // ok
+   ok &= table.size() == 4;
+   if( ok )
+   {  ok &= table[0] == cmpad::vector<std::string>{ "name", "value", "note" };
+      ok &= table[1] == cmpad::vector<std::string>{ "a,b", "1", "" };
+      ok &= table[2] ==
+         cmpad::vector<std::string>{ "say \"hi\"", "2", "two\nlines" };
+      ok &= table[3] == cmpad::vector<std::string>{ "c", "3", "last" };
+   }
+   //
+   // ok
+   // filter the rows and stop after the row with value 2
+   size_t n_call = 0;
+   std::string note;
+   cmpad::csv_scan_text(text,
+      [&](size_t, const cmpad::vector<std::string_view>& row)
+      {  ++n_call;
+         if( row[1] != "2" )
+            return true;
+         note = row[2];
+         return false;
+      }
+   );
+   ok &= n_call == 3;
+   ok &= note == "two\nlines";
+   //
+   // file_name
+   // csv_write quotes the values that csv_scan unquotes
+   std::string file_name = "xam_csv_scan.csv";
+   cmpad::csv_write(file_name, table);
+   //
+   // ok
+   size_t n_row = 0;
+   ok &= cmpad::csv_scan(file_name,
+      [&](size_t index, const cmpad::vector<std::string_view>& row)
+      {  ok &= row.size() == table[index].size();
+         for(size_t j = 0; j < row.size() && j < table[index].size(); ++j)
+            ok &= row[j] == table[index][j];
+         ++n_row;
+         return true;
+      }
+   );
+   ok &= n_row == table.size();
+   ok &= cmpad::csv_read(file_name) == table;
+   std::remove( file_name.c_str() );
+   //
+   return ok;
+}
+// END C++
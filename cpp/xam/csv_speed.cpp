@@ -20,8 +20,10 @@ Source Code
 
 // BEGIN C++
 # include <filesystem>
+# include <sstream>
 # include <cmpad/configure.hpp>
 # include <cmpad/algo/det_by_minor.hpp>
+# include <cmpad/alloc_count.hpp>
 # include <cmpad/fun_speed.hpp>
 # include <cmpad/csv_read.hpp>
 # include <cmpad/csv_speed.hpp>
@@ -69,15 +71,22 @@ bool xam_csv_speed(void)
    option.n_other     = 0;
    option.time_setup = false;
    //
+   // speed_option
+   cmpad::speed_option_t speed_option;
+   speed_option.n_warmup = 1;
+   speed_option.n_sample = 5;
+   speed_option.n_pool   = 3;
+   //
    // det_double
    cmpad::det_by_minor< cmpad::vector<double> > det_double;
    //
-   // rate
-   double rate = cmpad::fun_speed(det_double, option, min_time);
+   // speed
+   cmpad::speed_result_t speed =
+      cmpad::fun_speed(det_double, option, min_time, speed_option);
    //
    // csv_speed
    cmpad::csv_speed(
-      file_name, rate, min_time, package, algorithm, special, option
+      file_name, speed, min_time, package, algorithm, special, option
    );
    //
    // csv_table
@@ -106,7 +115,37 @@ bool xam_csv_speed(void)
       "compiler",
       "debug",
       "language",
-      "special"
+      "special",
+      "n_warmup",
+      "n_sample",
+      "n_pool",
+      "n_outlier",
+      "time_median",
+      "time_mad",
+      "time_min",
+      "time_lower",
+      "time_upper",
+      "time_init",
+      "break_even",
+      "n_op",
+      "n_var",
+      "tape_bytes",
+      "work_bytes",
+      "alloc_setup",
+      "byte_setup",
+      "alloc_eval",
+      "byte_eval",
+      "max_rss",
+      "clock",
+      "time_overhead",
+      "rel_error",
+      "ctx_switch",
+      "page_fault",
+      "cpu",
+      "governor",
+      "turbo",
+      "load_avg",
+      "time_sample"
    };
    size_t n_col = col_name.size();
    //
@@ -131,6 +170,57 @@ bool xam_csv_speed(void)
    ok &= csv_table[1][9] == debug;
    ok &= csv_table[1][10] == language;
    ok &= csv_table[1][11] == "false";
+   ok &= csv_table[1][12] == "1";
+   ok &= csv_table[1][13] == "5";
+   ok &= csv_table[1][14] == "3";
+   for(size_t j = 16; j < 22; ++j)
+      ok &= std::atof( csv_table[1][j].c_str() ) > 0.0;
+   //
+   // ok
+   // csv_speed does not set break_even, det_double is not a gradient,
+   // and the allocation columns depend on the cmpad configuration
+   for(size_t j = 22; j < 27; ++j)
+      ok &= csv_table[1][j] == "";
+   for(size_t j = 27; j < 31; ++j)
+   {  if( cmpad::alloc_count::enabled() )
+         ok &= csv_table[1][j] != "";
+      else
+         ok &= csv_table[1][j] == "";
+   }
+   //
+   // ok
+   // max_rss is empty when getrusage is not available
+   if( csv_table[1][31] != "" )
+      ok &= std::atof( csv_table[1][31].c_str() ) > 0.0;
+   //
+   // ok
+   // the default clock is used and its overhead is not negative
+   ok &= csv_table[1][32] == "steady";
+   ok &= std::atof( csv_table[1][33].c_str() ) >= 0.0;
+   //
+   // ok
+   // there are five samples so the relative error is defined
+   ok &= std::atof( csv_table[1][34].c_str() ) >= 0.0;
+   ok &= csv_table[1][34] != "";
+   //
+   // ok
+   // context switches and page faults are not negative (when available)
+   // and fun_speed does not set the environment columns
+   ok &= std::atof( csv_table[1][35].c_str() ) >= 0.0;
+   ok &= std::atof( csv_table[1][36].c_str() ) >= 0.0;
+   for(size_t j = 37; j < n_col - 1; ++j)
+      ok &= csv_table[1][j] == "";
+   //
+   // ok
+   // the last column has the five time samples
+   std::stringstream ss( csv_table[1][n_col - 1] );
+   size_t            n_time = 0;
+   double            time;
+   while( ss >> time )
+   {  ok &= 0.0 < time;
+      ++n_time;
+   }
+   ok &= n_time == 5;
    //
    return ok;
 }
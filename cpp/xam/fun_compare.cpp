@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_fun_compare.cpp}
+
+Example and Test of fun_compare
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_fun_compare.cpp}
+*/
+// BEGIN C++
+# include <cmpad/fun_compare.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+
+   // twice_det
+   // computes the determinant twice, so it should take about twice as long
+   class twice_det : public cmpad::fun_obj< cmpad::vector<double> > {
+   private:
+      // det_
+      cmpad::det_by_minor< cmpad::vector<double> > det_;
+      //
+      // y_
+      cmpad::vector<double> y_;
+   public:
+      //
+      // scalar_type
+      typedef double scalar_type;
+      //
+      // setup
+      void setup(const cmpad::option_t& option) override
+      {  det_.setup(option);
+         y_.resize(1);
+      }
+      // option
+      const cmpad::option_t& option(void) const override
+      {  return det_.option();
+      }
+      // domain
+      size_t domain(void) const override
+      {  return det_.domain();
+      }
+      // range
+      size_t range(void) const override
+      {  return 1;
+      }
+      // operator()
+      const cmpad::vector<double>& operator()(
+         const cmpad::vector<double>& x
+      ) override
+      {  y_[0]  = det_(x)[0];
+         y_[0] += det_(x)[0];
+         return y_;
+      }
+   };
+
+} // END_EMPTY_NAMESPACE
+
+bool xam_fun_compare(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg      = 16;
+   option.n_other    = 0;
+   option.time_setup = false;
+   //
+   // speed_option
+   cmpad::speed_option_t speed_option;
+   speed_option.n_sample = 9;
+   //
+   // min_time
+   double min_time = 0.1;
+   //
+   // fun_vec
+   cmpad::det_by_minor< cmpad::vector<double> > once;
+   twice_det                                    twice;
+   cmpad::vector< cmpad::fun_obj< cmpad::vector<double> >* > fun_vec =
+      { &once, &twice };
+   //
+   // speed
+   cmpad::vector<cmpad::speed_result_t> speed =
+      cmpad::fun_compare(fun_vec, option, min_time, speed_option);
+   //
+   // ok
+   ok &= speed.size() == 2;
+   for(size_t k = 0; k < 2; ++k)
+   {  ok &= speed[k].n_sample == 9;
+      ok &= speed[k].time_sample.size() == 9;
+      ok &= 0.0 < speed[k].time_median;
+      ok &= 0.0 < speed[k].time_init;
+      ok &= speed[k].ratio_lower  <= speed[k].ratio_median;
+      ok &= speed[k].ratio_median <= speed[k].ratio_upper;
+   }
+   //
+   // ok
+   // the ratio of the base to itself is one
+   ok &= speed[0].ratio_median == 1.0;
+   //
+   // ok
+   // computing the determinant twice is slower than computing it once
+   ok &= 1.0 < speed[1].ratio_median;
+   //
+   // speed
+   // flush the caches before each computation
+   speed_option.n_sample    = 3;
+   speed_option.flush_cache = true;
+   speed = cmpad::fun_compare(fun_vec, option, 0.01, speed_option);
+   //
+   // ok
+   for(size_t k = 0; k < 2; ++k)
+   {  ok &= speed[k].flush_cache;
+      ok &= speed[k].time_sample.size() == 3;
+      ok &= 0.0 < speed[k].time_median;
+   }
+   //
+   return ok;
+}
+// END C++
@@ -105,6 +105,25 @@ namespace { // BEGIN_EMPTY_NAMESPACE
          std::cout << "ratio = " << ratio << "\n";
       }
       //
+      // speed_option
+      cmpad::speed_option_t speed_option;
+      speed_option.n_warmup = 2;
+      speed_option.n_sample = 10;
+      //
+      // speed
+      cmpad::speed_result_t speed =
+         cmpad::fun_speed(my_fun, option_one, min_time, speed_option);
+      //
+      // ok
+      ok &= speed.n_warmup == 2;
+      ok &= speed.n_sample == 10;
+      ok &= speed.time_sample.size() == 10;
+      ok &= speed.n_outlier < 10;
+      ok &= speed.time_min    <= speed.time_median;
+      ok &= speed.time_lower  <= speed.time_median;
+      ok &= speed.time_median <= speed.time_upper;
+      ok &= speed.rate == 1.0 / speed.time_median;
+      //
       return ok;
    }
 } // END_EMPTY_NAMESPACE
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_jit_lib.cpp}
+
+Example and Test of jit_lib
+###########################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_jit_lib.cpp}
+*/
+// BEGIN C++
+# include <filesystem>
+# include <fstream>
+# include <cmpad/jit_lib.hpp>
+
+# ifdef __linux__
+# include <dlfcn.h>
+# include <unistd.h>
+# endif
+
+bool xam_jit_lib(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // filesystem
+   namespace filesystem = std::filesystem;
+   //
+   // dir_one, dir_two
+   filesystem::path dir_one = cmpad::jit_lib::new_dir("xam_jit_lib");
+   filesystem::path dir_two = cmpad::jit_lib::new_dir("xam_jit_lib");
+   //
+   // ok
+   // each call creates a different directory
+   ok &= filesystem::is_directory(dir_one);
+   ok &= filesystem::is_directory(dir_two);
+   ok &= dir_one != dir_two;
+   ok &= dir_one.parent_path() == dir_two.parent_path();
+   //
+   // a directory is removed when the perf map is not enabled
+   std::ofstream( dir_one / "file.txt" ) << "text\n";
+   cmpad::jit_lib::release_dir(dir_one);
+   ok &= ! filesystem::exists(dir_one);
+   //
+   // ok
+   // a directory is kept when the perf map is enabled
+   cmpad::jit_lib::enable_perf_map(true);
+   cmpad::jit_lib::release_dir(dir_two);
+   ok &= filesystem::is_directory(dir_two);
+   cmpad::jit_lib::enable_perf_map(false);
+   filesystem::remove(dir_two);
+   //
+   // ok
+   // the perf map is not enabled by default
+   ok &= ! cmpad::jit_lib::perf_map_enabled();
+# ifdef __linux__
+   //
+   // lib_dir
+   // directory containing the cmpad library
+   Dl_info info;
+   void*   address = reinterpret_cast<void*>( &cmpad::jit_lib::new_dir );
+   ok &= dladdr(address, &info) != 0;
+   filesystem::path lib_dir = filesystem::path(info.dli_fname).parent_path();
+   //
+   // map_file
+   std::string map_file = "/tmp/perf-" + std::to_string( getpid() ) + ".map";
+   bool map_exists = filesystem::exists(map_file);
+   //
+   // ok
+   // nothing is written when the perf map is not enabled
+   ok &= cmpad::jit_lib::perf_map(lib_dir) == 0;
+   //
+   // ok
+   // the cmpad library functions are written when it is enabled
+   cmpad::jit_lib::enable_perf_map(true);
+   ok &= cmpad::jit_lib::perf_map_enabled();
+   ok &= cmpad::jit_lib::perf_map(lib_dir) > 0;
+   ok &= filesystem::file_size(map_file) > 0;
+   cmpad::jit_lib::enable_perf_map(false);
+   //
+   // map_file
+   if( ! map_exists )
+      filesystem::remove(map_file);
+# endif
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_latency_histogram.cpp}
+
+Example and Test of latency_histogram
+#####################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_latency_histogram.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/latency_histogram.hpp>
+
+bool xam_latency_histogram(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // histogram
+   cmpad::latency_histogram histogram;
+   ok &= histogram.n_call() == 0;
+   ok &= std::isnan( histogram.percentile(50.0) );
+   ok &= std::isnan( histogram.max() );
+   //
+   // histogram
+   // 98 latencies of 10 nanoseconds, one of 100 and one of 1000
+   for(size_t i = 0; i < 98; ++i)
+      histogram.record(10);
+   histogram.record(100);
+   histogram.record(1000);
+   ok &= histogram.n_call() == 100;
+   //
+   // ok
+   // values less than 32 nanoseconds are exact
+   double ns = 1e-9;
+   ok &= histogram.percentile(50.0) == 11.0 * ns;
+   ok &= histogram.percentile(98.0) == 11.0 * ns;
+   //
+   // ok
+   // 100 is in the bucket [100, 102) because 100 = 50 * 2
+   ok &= histogram.percentile(99.0) == 102.0 * ns;
+   //
+   // ok
+   // 1000 is in the bucket [992, 1024), the result is limited by the max
+   ok &= histogram.percentile(99.9) == 1000.0 * ns;
+   ok &= histogram.max()            == 1000.0 * ns;
+   //
+   // ok
+   // check the buckets
+   size_t n_nonzero = 0;
+   size_t n_call    = 0;
+   for(size_t index = 0; index < histogram.n_bucket; ++index)
+   {  if( histogram.count(index) > 0 )
+      {  ++n_nonzero;
+         n_call += size_t( histogram.count(index) );
+         ok &= histogram.lower(index) < histogram.upper(index);
+         if( histogram.count(index) == 1 )
+         {  double lower = histogram.lower(index);
+            double upper = histogram.upper(index);
+            ok &= ( lower <= 100.0 * ns && 100.0 * ns < upper ) ||
+                  ( lower <= 1000.0 * ns && 1000.0 * ns < upper );
+         }
+      }
+   }
+   ok &= n_nonzero == 3;
+   ok &= n_call    == 100;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_mann_whitney.cpp}
+
+Example and Test of mann_whitney
+################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_mann_whitney.cpp}
+*/
+// BEGIN C++
+# include <algorithm>
+# include <cmath>
+# include <limits>
+# include <vector>
+# include <cmpad/mann_whitney.hpp>
+# include <cmpad/near_equal.hpp>
+
+bool xam_mann_whitney(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // eps99
+   double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+   //
+   // alpha
+   double alpha = 0.05;
+   //
+   // result
+   // every baseline sample is less than every candidate sample
+   cmpad::vector<double> baseline  = { 1.0, 2.0, 3.0 };
+   cmpad::vector<double> candidate = { 4.0, 5.0, 6.0 };
+   cmpad::mann_whitney_t result =
+      cmpad::mann_whitney(baseline, candidate, alpha);
+   //
+   // ok
+   // mean 4.5, variance 5.25, z = (4.5 - 0.5) / sqrt(5.25)
+   ok &= result.u == 0.0;
+   double z = 4.0 / std::sqrt(5.25);
+   double p = std::erfc( z / std::sqrt(2.0) );
+   ok &= cmpad::near_equal(result.p_value, p, eps99);
+   ok &= cmpad::near_equal(result.speedup, 2.0 / 5.0, eps99);
+   //
+   // result
+   // the candidate takes twice as long
+   baseline.resize(20);
+   candidate.resize(20);
+   for(size_t i = 0; i < 20; ++i)
+   {  baseline[i]  = 1.0 + 0.01 * double(i);
+      candidate[i] = 2.0 * baseline[i];
+   }
+   result = cmpad::mann_whitney(baseline, candidate, alpha);
+   //
+   // ok
+   ok &= result.u == 0.0;
+   ok &= result.p_value < 1e-6;
+   ok &= cmpad::near_equal(result.speedup, 0.5, eps99);
+   ok &= result.speedup_lower < 0.5 && 0.5 < result.speedup_upper;
+   ok &= result.speedup_upper < 0.6;
+   //
+   // result
+   // the same samples
+   result = cmpad::mann_whitney(baseline, baseline, alpha);
+   //
+   // ok
+   ok &= result.u == 200.0;
+   ok &= result.p_value == 1.0;
+   ok &= cmpad::near_equal(result.speedup, 1.0, eps99);
+   ok &= result.speedup_lower < 1.0 && 1.0 < result.speedup_upper;
+   //
+   // baseline, candidate
+   // more pairs than are kept during the selection of the order statistics
+   size_t n1 = 37;
+   size_t n2 = 53;
+   baseline.resize(n1);
+   candidate.resize(n2);
+   for(size_t i = 0; i < n1; ++i)
+      baseline[i] = 1.0 + double( (i * 17) % n1 ) / double(n1);
+   for(size_t j = 0; j < n2; ++j)
+      candidate[j] = 1.5 + double( (j * 29) % n2 ) / double(n2);
+   result = cmpad::mann_whitney(baseline, candidate, alpha);
+   //
+   // difference
+   // all the differences, sorted
+   std::vector<double> difference;
+   for(size_t i = 0; i < n1; ++i)
+   {  for(size_t j = 0; j < n2; ++j)
+         difference.push_back(
+            std::log( baseline[i] ) - std::log( candidate[j] )
+         );
+   }
+   std::sort(difference.begin(), difference.end());
+   //
+   // ok
+   // n1 * n2 is odd
+   size_t n_pair = n1 * n2;
+   double median = difference[n_pair / 2];
+   ok &= cmpad::near_equal(result.speedup, std::exp(median), eps99);
+   double lower  = std::log( result.speedup_lower );
+   double upper  = std::log( result.speedup_upper );
+   size_t index  = size_t(
+      std::lower_bound(difference.begin(), difference.end(), lower)
+      - difference.begin()
+   );
+   ok &= index < n_pair;
+   ok &= cmpad::near_equal(difference[index], lower, eps99);
+   ok &= cmpad::near_equal(difference[n_pair - 1 - index], upper, eps99);
+   //
+   // result
+   // a large number of pairs
+   n1 = 4000;
+   n2 = 5000;
+   baseline.resize(n1);
+   candidate.resize(n2);
+   for(size_t i = 0; i < n1; ++i)
+      baseline[i] = 2.0 * ( 1.0 + double(i) / double(n1) );
+   for(size_t j = 0; j < n2; ++j)
+      candidate[j] = 1.0 + double(j) / double(n2);
+   result = cmpad::mann_whitney(baseline, candidate, alpha);
+   //
+   // ok
+   ok &= cmpad::near_equal(result.speedup, 2.0, 1e-3);
+   ok &= result.speedup_lower < result.speedup;
+   ok &= result.speedup < result.speedup_upper;
+   ok &= result.speedup_upper < 2.1;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_perf_counter.cpp}
+
+Example and Test of perf_counter
+################################
+This example does not fail when the kernel does not allow
+hardware events to be counted.
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_perf_counter.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <string>
+# include <cmpad/perf_counter.hpp>
+
+bool xam_perf_counter(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // event names
+   ok &= std::string( cmpad::perf_counter::name(0) ) == "cycles";
+   ok &= std::string(
+      cmpad::perf_counter::name( cmpad::perf_counter::dtlb_miss )
+   ) == "dtlb_miss";
+   //
+   // counter
+   cmpad::perf_counter counter;
+   //
+   // ok
+   // no events are open before calling open
+   for(size_t event = 0; event < cmpad::perf_counter::n_event; ++event)
+      ok &= std::isnan( counter.count(event) );
+   //
+   // n_open
+   size_t n_open = counter.open();
+   ok &= n_open <= cmpad::perf_counter::n_event;
+   //
+   // sum
+   // volatile so that the loop is not optimized out
+   size_t n_loop = 100000;
+   volatile double sum = 0.0;
+   counter.start();
+   for(size_t i = 0; i < n_loop; ++i)
+      sum = sum + double(i);
+   counter.stop();
+   ok &= sum == double(n_loop) * double(n_loop - 1) / 2.0;
+   //
+   // instructions
+   // each iteration of the loop requires more than one instruction
+   double instructions = counter.count(cmpad::perf_counter::instructions);
+   if( ! std::isnan(instructions) )
+      ok &= double(n_loop) < instructions;
+   //
+   // ok
+   for(size_t event = 0; event < cmpad::perf_counter::n_event; ++event)
+   {  double value = counter.count(event);
+      ok &= std::isnan(value) || 0.0 <= value;
+   }
+   //
+   // ok
+   // after a reset the counts are zero
+   counter.reset();
+   for(size_t event = 0; event < cmpad::perf_counter::n_event; ++event)
+   {  double value = counter.count(event);
+      ok &= std::isnan(value) || value == 0.0;
+   }
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_phase_timer.cpp}
+
+Example and Test of phase_timer
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_phase_timer.cpp}
+*/
+// BEGIN C++
+# include <cmpad/phase_timer.hpp>
+
+namespace {
+   // busy
+   // do some work so that the phase takes a non-zero amount of time
+   double busy(size_t n)
+   {  volatile double sum = 0.0;
+      for(size_t i = 0; i < n; ++i)
+         sum = sum + double(i);
+      return sum;
+   }
+}
+
+bool xam_phase_timer(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // phase_vec
+   const cmpad::vector<cmpad::phase_t>& phase_vec =
+      cmpad::phase_timer::phase_vec();
+   //
+   // ok
+   // timers do nothing when timing is not enabled
+   cmpad::phase_timer::clear();
+   ok &= ! cmpad::phase_timer::enabled();
+   {  cmpad::phase_timer timer("disabled");
+      busy(1000);
+   }
+   ok &= phase_vec.size() == 0;
+   //
+   // enable
+   cmpad::phase_timer::enable(true);
+   //
+   // outer, inner
+   // the inner phase is done twice and nested in the outer phase
+   {  cmpad::phase_timer outer("outer");
+      for(size_t k = 0; k < 2; ++k)
+      {  cmpad::phase_timer inner("inner");
+         busy(1000);
+         inner.stop();
+         busy(1000);
+      }
+   }
+   //
+   // last
+   cmpad::phase_timer last("last");
+   busy(1000);
+   last.stop();
+   //
+   // enable
+   cmpad::phase_timer::enable(false);
+   //
+   // ok
+   // phases are in the order they were first stopped
+   ok &= phase_vec.size() == 3;
+   if( ok )
+   {  ok &= phase_vec[0].name == "inner";
+      ok &= phase_vec[1].name == "outer";
+      ok &= phase_vec[2].name == "last";
+      ok &= 0.0 < phase_vec[0].seconds;
+      ok &= phase_vec[0].seconds < phase_vec[1].seconds;
+      ok &= 0.0 < phase_vec[2].seconds;
+   }
+   //
+   // clear
+   cmpad::phase_timer::clear();
+   ok &= phase_vec.size() == 0;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_results_query.cpp}
+
+Example and Test of results_query
+#################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_results_query.cpp}
+*/
+// BEGIN C++
+# include <cstdio>
+# include <filesystem>
+# include <cmpad/results_query.hpp>
+# include <cmpad/results_store.hpp>
+# include <cmpad/csv_write.hpp>
+
+bool xam_results_query(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // results
+   cmpad::vec_vec_str results = {
+      { "rate",    "package", "algorithm", "n_arg", "date"       },
+      { "1.0e+06", "cppad",   "an_ode",    "4",     "2026-10-18" },
+      { "3.0e+06", "cppad",   "an_ode",    "4",     "2026-10-17" },
+      { "4.0e+06", "codi",    "an_ode",    "4",     "2026-10-18" },
+      { "2.0e+06", "cppad",   "an_ode",    "16",    "2026-10-18" },
+      { "6.0e+06", "codi",    "an_ode",    "16",    "2026-10-18" },
+      { "9.0e+06", "codi",    "an_ode",    "16",    "2026-8-1"   },
+      { "5.0e+06", "codi",    "llsq_obj",  "4",     "2026-10-18" }
+   };
+   //
+   // file_name, dir
+   // the same results in a csv file and in a binary store
+   std::string file_name = "xam_results_query.csv";
+   std::string dir       = "xam_results_query";
+   cmpad::csv_write(file_name, results);
+   std::filesystem::remove_all(dir);
+   for(size_t i = 1; i < results.size(); ++i)
+      ok &= cmpad::results_store::append(dir, results[0], results[i]);
+   //
+   for(const std::string& source : { file_name, dir } )
+   {  //
+      // query
+      // best rate per package for an_ode over the last 30 days
+      cmpad::query_t query;
+      query.where = { "algorithm=an_ode" };
+      query.days  = 30;
+      query.today = "2026-10-18";
+      query.group = { "package" };
+      query.stat  = "max";
+      //
+      // ok
+      cmpad::vec_vec_str table;
+      ok &= cmpad::results_query(source, query, table) == "";
+      ok &= table == cmpad::vec_vec_str{
+         { "package", "count", "max_rate" },
+         { "codi",    "2",     "6e+06"    },
+         { "cppad",   "3",     "3e+06"    }
+      };
+      //
+      // query
+      // speedup of codi over cppad for each n_arg
+      query       = cmpad::query_t();
+      query.where = { "algorithm=an_ode", "n_arg>=4" };
+      query.stat  = "min";
+      query.pivot_row = "package";
+      query.pivot_col = "n_arg";
+      query.base      = "cppad";
+      //
+      // ok
+      ok &= cmpad::results_query(source, query, table) == "";
+      ok &= table == cmpad::vec_vec_str{
+         { "package", "4", "16" },
+         { "codi",    "4", "3"  },
+         { "cppad",   "1", "1"  }
+      };
+      //
+      // ok
+      // an error message
+      query.stat = "mode";
+      ok &= cmpad::results_query(source, query, table) != "";
+      ok &= table.size() == 0;
+   }
+   //
+   std::remove( file_name.c_str() );
+   std::filesystem::remove_all(dir);
+   return ok;
+}
+// END C++
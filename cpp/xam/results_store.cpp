@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_results_store.cpp}
+
+Example and Test of results_store
+#################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_results_store.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <filesystem>
+# include <cmpad/results_store.hpp>
+
+bool xam_results_store(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // dir
+   std::string dir = "xam_results_store";
+   std::filesystem::remove_all(dir);
+   //
+   // append
+   // the governor column is not added until it has a value
+   cmpad::vector<std::string> col_name =
+      { "rate", "package", "algorithm", "n_arg", "governor" };
+   ok &= cmpad::results_store::append(
+      dir, col_name, { "1.0e+06", "none", "det_by_minor", "9", "" }
+   );
+   ok &= cmpad::results_store::append(
+      dir, col_name, { "2.0e+06", "cppad", "det_by_minor", "9", "powersave" }
+   );
+   //
+   // append
+   // a new numeric column and a row without the governor column
+   col_name = { "rate", "package", "algorithm", "n_arg", "n_flop" };
+   ok &= cmpad::results_store::append(
+      dir, col_name, { "3.0e+06", "none", "det_by_minor", "9", "18" }
+   );
+   ok &= cmpad::results_store::append(
+      dir, col_name, { "4.0e+06", "none", "det_by_minor", "16", "60" }
+   );
+   //
+   // store
+   cmpad::results_store store(dir);
+   ok &= store.ok();
+   ok &= store.n_row() == 4;
+   ok &= store.col_name() == cmpad::vector<std::string>{
+      "rate", "package", "algorithm", "n_arg", "governor", "n_flop"
+   };
+   ok &= store.numeric("rate");
+   ok &= ! store.numeric("package");
+   //
+   // ok
+   // rate
+   const double* rate = store.f64("rate");
+   ok &= rate != nullptr;
+   if( rate != nullptr )
+   {  for(size_t i = 0; i < 4; ++i)
+         ok &= rate[i] == double(i + 1) * 1e6;
+   }
+   //
+   // ok
+   // package
+   const uint32_t* code = store.code("package");
+   const cmpad::vector<std::string>& dict = store.dict("package");
+   ok &= code != nullptr;
+   if( code != nullptr )
+   {  ok &= dict[ code[0] ] == "none";
+      ok &= dict[ code[1] ] == "cppad";
+      ok &= code[2] == code[0];
+   }
+   ok &= store.f64("package") == nullptr;
+   //
+   // ok
+   // missing values
+   ok &= std::isnan( store.f64("n_flop")[1] );
+   ok &= store.text("n_flop", 3) == "60";
+   ok &= store.text("governor", 0) == "";
+   ok &= store.text("governor", 1) == "powersave";
+   ok &= store.text("governor", 2) == "";
+   //
+   // ok
+   // rows
+   ok &= store.rows("none", "det_by_minor", 9)
+      == cmpad::vector<size_t>{ 0, 2 };
+   ok &= store.rows("none", "det_by_minor", 16)
+      == cmpad::vector<size_t>{ 3 };
+   ok &= store.rows("none", "llsq_obj", 9).size() == 0;
+   //
+   std::filesystem::remove_all(dir);
+   return ok;
+}
+// END C++
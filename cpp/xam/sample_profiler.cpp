@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_sample_profiler.cpp}
+
+Example and Test of sample_profiler
+###################################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_sample_profiler.cpp}
+*/
+// BEGIN C++
+# include <ctime>
+# include <sstream>
+# include <cmpad/sample_profiler.hpp>
+
+// XAM_SAMPLE_PROFILER_NOINLINE
+// the busy function must appear in the call stacks
+# if defined(__GNUC__) || defined(__clang__)
+# define XAM_SAMPLE_PROFILER_NOINLINE __attribute__((noinline))
+# elif defined(_MSC_VER)
+# define XAM_SAMPLE_PROFILER_NOINLINE __declspec(noinline)
+# else
+# define XAM_SAMPLE_PROFILER_NOINLINE
+# endif
+
+// xam_sample_profiler_busy
+// This function is not in an anonymous namespace so that its name is
+// in the dynamic symbol table for the library that contains it.
+XAM_SAMPLE_PROFILER_NOINLINE
+double xam_sample_profiler_busy(double seconds)
+{  volatile double sum   = 0.0;
+   std::clock_t    start = std::clock();
+   while( double( std::clock() - start ) < seconds * CLOCKS_PER_SEC )
+   {  for(size_t i = 0; i < 1000; ++i)
+         sum = sum + double(i);
+   }
+   return sum;
+}
+
+bool xam_sample_profiler(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   ok &= ! cmpad::sample_profiler::running();
+   ok &= ! cmpad::sample_profiler::start(0.0);
+# ifndef __linux__
+   ok &= ! cmpad::sample_profiler::start(1e-3);
+# else
+   //
+   // ok
+   // one sample every millisecond for two tenths of a second
+   ok &= cmpad::sample_profiler::start(1e-3);
+   ok &= cmpad::sample_profiler::running();
+   ok &= ! cmpad::sample_profiler::start(1e-3);
+   xam_sample_profiler_busy(0.2);
+   cmpad::sample_profiler::stop();
+   ok &= ! cmpad::sample_profiler::running();
+   //
+   // n_sample
+   size_t n_sample = cmpad::sample_profiler::n_sample();
+   // the kernel may round the interval up to its clock tick; e.g. 4 ms
+   ok &= 10 <= n_sample;
+   ok &= cmpad::sample_profiler::n_lost() == 0;
+   //
+   // profile
+   cmpad::vector<cmpad::profile_t> profile =
+      cmpad::sample_profiler::profile();
+   //
+   // ok
+   // most of the time is spent in the busy function
+   // and all of the time is spent in xam_sample_profiler
+   bool found_busy = false;
+   bool found_xam  = false;
+   for(size_t k = 0; k < profile.size(); ++k)
+   {  if( profile[k].name == "xam_sample_profiler_busy(double)" )
+      {  found_busy = true;
+         ok &= 2 * profile[k].flat > n_sample;
+      }
+      if( profile[k].name == "xam_sample_profiler()" )
+      {  found_xam = true;
+         ok &= profile[k].flat == 0;
+         ok &= 2 * profile[k].cumulative > n_sample;
+      }
+   }
+   ok &= found_busy && found_xam;
+   //
+   // ok
+   std::stringstream os;
+   cmpad::sample_profiler::print(os, profile, n_sample, 5);
+   ok &= os.str().find("flat profile:") == 0;
+   ok &= os.str().find("cumulative profile:") != std::string::npos;
+   ok &= os.str().find("xam_sample_profiler_busy(double)") != std::string::npos;
+   //
+   // ok
+   // no samples are recorded while the profiler is paused
+   ok &= cmpad::sample_profiler::start(1e-3);
+   cmpad::sample_profiler::pause(true);
+   xam_sample_profiler_busy(0.05);
+   cmpad::sample_profiler::pause(false);
+   cmpad::sample_profiler::stop();
+   ok &= cmpad::sample_profiler::n_sample() == 0;
+# endif
+   //
+   return ok;
+}
+// END C++
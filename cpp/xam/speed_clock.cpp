@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_speed_clock.cpp}
+
+Example and Test of speed_clock
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_speed_clock.cpp}
+*/
+// BEGIN C++
+# include <string>
+# include <chrono>
+# include <cmpad/vector.hpp>
+# include <cmpad/speed_clock.hpp>
+
+bool xam_speed_clock(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   ok &= cmpad::speed_clock::available("steady");
+   ok &= ! cmpad::speed_clock::available("sundial");
+   //
+   // name_vec
+   cmpad::vector<std::string> name_vec = { "steady", "tsc", "raw" };
+   for(size_t i = 0; i < name_vec.size(); ++i)
+   if( cmpad::speed_clock::available( name_vec[i] ) )
+   {  //
+      // clock
+      cmpad::speed_clock clock( name_vec[i] );
+      ok &= clock.name() == name_vec[i];
+      //
+      // t_start, t_end, seconds
+      // busy wait for 10 milliseconds using the steady clock
+      using std::chrono::steady_clock;
+      steady_clock::time_point s_start = steady_clock::now();
+      uint64_t                 t_start = clock.tick();
+      double steady = 0.0;
+      while( steady < 0.01 )
+      {  std::chrono::duration<double> diff = steady_clock::now() - s_start;
+         steady = diff.count();
+      }
+      uint64_t t_end   = clock.tick();
+      double   seconds = clock.seconds(t_end - t_start);
+      //
+      // ok
+      // the clocks agree to within 10 percent
+      ok &= 0.9 * steady < seconds && seconds < 1.1 * steady;
+      //
+      // ok
+      // reading the clock takes less than a microsecond
+      double overhead = clock.overhead();
+      ok &= 0.0 <= overhead && overhead < 1e-6;
+      //
+      // ok
+      // an empty pass advances the pool index modulo the pool size
+      cmpad::vector< cmpad::vector<double> > pool(3);
+      size_t i_pool = 0;
+      double empty  = clock.empty_pass(pool, i_pool, 1000, false);
+      ok &= 0.0 <= empty && empty < 1e-3;
+      ok &= i_pool == 1000 % 3;
+      empty  = clock.empty_pass(pool, i_pool, 1000, true);
+      ok &= 0.0 <= empty && empty < 1e-3;
+      ok &= i_pool == 2000 % 3;
+   }
+   //
+   return ok;
+}
+// END C++
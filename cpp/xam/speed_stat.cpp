@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_speed_stat.cpp}
+
+Example and Test of speed_stat
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_speed_stat.cpp}
+*/
+// BEGIN C++
+# include <cmath>
+# include <cmpad/speed_stat.hpp>
+
+bool xam_speed_stat(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // speed
+   // the sample 9.0 is an outlier
+   cmpad::speed_result_t speed;
+   speed.time_sample = { 2.0, 1.0, 3.0, 9.0, 2.0 };
+   speed.n_sample    = speed.time_sample.size();
+   //
+   // speed
+   cmpad::speed_stat(speed);
+   //
+   // ok
+   // after rejecting the outlier the samples are 1, 2, 2, 3
+   ok &= speed.n_outlier   == 1;
+   ok &= speed.time_median == 2.0;
+   ok &= speed.time_mad    == 0.5;
+   ok &= speed.time_min    == 1.0;
+   ok &= speed.time_lower  == 1.0;
+   ok &= speed.time_upper  == 3.0;
+   ok &= speed.rate        == 0.5;
+   //
+   // ok
+   // the mean of the samples that are not rejected is 2, their standard
+   // deviation is sqrt(2/3), and the relative standard error is
+   // sqrt(2/3) / ( sqrt(4) * 2 )
+   double rel_error = std::sqrt(2.0 / 3.0) / 4.0;
+   ok &= std::fabs( speed.rel_error - rel_error ) < 1e-14;
+   //
+   // ok
+   // the samples are not modified
+   ok &= speed.time_sample.size() == 5;
+   ok &= speed.time_sample[3]     == 9.0;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_static_fun.cpp}
+
+Example and Test of static_fun
+##############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_static_fun.cpp}
+*/
+// BEGIN C++
+# include <type_traits>
+# include <cmpad/static_fun.hpp>
+# include <cmpad/fun_speed.hpp>
+# include <cmpad/algo/det_by_minor.hpp>
+
+bool xam_static_fun(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // virtual_det, static_det
+   typedef cmpad::det_by_minor< cmpad::vector<double> > virtual_det;
+   typedef cmpad::static_fun<virtual_det>               static_det;
+   //
+   // ok
+   ok &= ! std::is_final<virtual_det>::value;
+   ok &= std::is_final<static_det>::value;
+   ok &= std::is_base_of<virtual_det, static_det>::value;
+   //
+   // option
+   cmpad::option_t option;
+   option.n_arg      = 9;
+   option.n_other    = 0;
+   option.time_setup = false;
+   //
+   // det_virtual, det_static
+   virtual_det det_virtual;
+   static_det  det_static;
+   det_virtual.setup(option);
+   det_static.setup(option);
+   //
+   // ok
+   // both objects compute the same function
+   cmpad::vector<double> x = { 2., 0., 0., 0., 3., 0., 0., 0., 4. };
+   ok &= det_static.domain() == det_virtual.domain();
+   ok &= det_static(x)[0] == det_virtual(x)[0];
+   ok &= det_static(x)[0] == 24.0;
+   //
+   // ok
+   // fun_speed can time the static dispatch version
+   double min_time = 0.05;
+   double rate     = cmpad::fun_speed(det_static, option, min_time);
+   ok &= 0.0 < rate;
+   //
+   return ok;
+}
+// END C++
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: EPL-2.0 OR GPL-2.0-or-later
+// SPDX-FileCopyrightText: Bradley M. Bell <bradbell@seanet.com>
+// SPDX-FileContributor: 2026 Bradley M. Bell
+// ---------------------------------------------------------------------------
+/*
+{xrst_begin xam_trace_event.cpp}
+
+Example and Test of trace_event
+###############################
+{xrst_literal
+   // BEGIN C++
+   // END C++
+}
+
+{xrst_end xam_trace_event.cpp}
+*/
+// BEGIN C++
+# include <cstdio>
+# include <fstream>
+# include <sstream>
+# include <thread>
+# include <cmpad/trace_event.hpp>
+
+bool xam_trace_event(void)
+{  //
+   // ok
+   bool ok = true;
+   //
+   // ok
+   // spans do nothing when recording is not enabled
+   cmpad::trace_event::clear();
+   ok &= ! cmpad::trace_event::enabled();
+   {  cmpad::trace_event span("disabled", "xam");
+      span.arg("value", 1.0);
+   }
+   ok &= cmpad::trace_event::n_event() == 0;
+   //
+   // start
+   // a time before recording was enabled
+   cmpad::trace_event::time_point start = std::chrono::steady_clock::now();
+   //
+   // enable
+   cmpad::trace_event::enable(true);
+   //
+   // before
+   cmpad::trace_event::complete(
+      "before", "xam", start, std::chrono::steady_clock::now()
+   );
+   //
+   // outer, inner
+   // the inner span is nested in the outer span and has an argument
+   {  cmpad::trace_event outer("outer", "xam");
+      cmpad::trace_event inner("inner", "xam");
+      inner.arg("repeat", 16.0);
+      inner.stop();
+   }
+   //
+   // worker
+   // a span recorded by another thread
+   std::thread worker( [](void)
+   {  cmpad::trace_event span("worker", "xam"); }
+   );
+   worker.join();
+   //
+   // enable
+   cmpad::trace_event::enable(false);
+   ok &= cmpad::trace_event::n_event() == 4;
+   //
+   // file_name
+   std::string file_name = "xam_trace_event.json";
+   ok &= cmpad::trace_event::write(file_name);
+   cmpad::trace_event::clear();
+   ok &= cmpad::trace_event::n_event() == 0;
+   //
+   // json
+   std::ifstream     file(file_name);
+   std::stringstream json;
+   json << file.rdbuf();
+   file.close();
+   std::remove( file_name.c_str() );
+   //
+   // ok
+   std::string data = json.str();
+   ok &= data.find("{\"traceEvents\":[") == 0;
+   ok &= data.find("\"name\":\"before\"") != std::string::npos;
+   ok &= data.find("\"name\":\"outer\"")  != std::string::npos;
+   ok &= data.find("\"args\":{\"repeat\":16}") != std::string::npos;
+   ok &= data.find("\"name\":\"main\"")     != std::string::npos;
+   ok &= data.find("\"name\":\"thread_1\"") != std::string::npos;
+   ok &= data.find("\"name\":\"disabled\"") == std::string::npos;
+   //
+   return ok;
+}
+// END C++
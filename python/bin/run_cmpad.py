@@ -217,9 +217,9 @@ def main() :
    #
    # min_time
    min_time = float( arguments.min_time )
-   if min_time <= 0.0 or 1.0 < min_time :
+   if min_time <= 0.0 :
       msg  = f'{program}: min_time = {min_time} '
-      msg += 'is less than or equal zero or greater than one'
+      msg += 'is less than or equal zero'
       sys.exit(msg)
    #
    # time_setup
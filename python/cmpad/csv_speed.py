@@ -20,13 +20,14 @@ file_name
 This is the name of the file were the results will be recorded.
 This file uses the :ref:`csv_column-name` format.
 
-#. If the file is empty on input, the following csv header line
-   is written as the first line of the file; i.e.,
-   {xrst_literal
-      xrst/csv_column.xrst
-      BEGIN HEADER_LINE
-      END HEADER_LINE
-   }
+#. If the file is empty on input, a csv header line is written
+   as the first line of the file.
+   It contains the :ref:`csv_column-name` names from *rate* through *special* .
+
+#. If the file is not empty on input, the columns in its header line
+   are preserved.
+   The columns that are only written by the C++ version of run_cmpad
+   have an empty value in the new row.
 
 #. A line is added to this file corresponding to
    this call to csv_speed.
@@ -120,13 +121,18 @@ def csv_speed(
       'special'
    ]
    #
-   # csv_table
+   # csv_table, filednames
    csv_table = list()
    if os.path.exists( file_name ) :
       file_obj  = open(file_name, 'r')
       reader    = csv.DictReader(file_obj)
       for row in reader :
          csv_table.append(row)
+      if reader.fieldnames != None :
+         for name in filednames :
+            if name not in reader.fieldnames :
+               reader.fieldnames.append(name)
+         filednames = reader.fieldnames
       file_obj.close()
    #
    # date
@@ -167,7 +173,7 @@ def csv_speed(
    #
    # file_name
    file_obj = open(file_name, 'w')
-   writer   = csv.DictWriter(file_obj, fieldnames = filednames)
+   writer   = csv.DictWriter(file_obj, fieldnames = filednames, restval = '')
    writer.writeheader()
    for row in csv_table :
       writer.writerow( row )